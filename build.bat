@@ -1,4 +1,5 @@
 @echo off
+setlocal EnableDelayedExpansion
 echo ========================================
 echo  Real-Time Scheduling System - Build
 echo ========================================
@@ -18,25 +19,62 @@ echo.
 REM Create build directory if not exists
 if not exist "build" mkdir build
 
+REM Keep this list in sync with add_executable(rt_scheduler ...) in CMakeLists.txt
+set SOURCES=src\utils\FileReader.cpp ^
+    src\utils\ColumnarWriter.cpp ^
+    src\utils\TracePyramid.cpp ^
+    src\utils\InputCache.cpp ^
+    src\utils\FileWatcher.cpp ^
+    src\utils\ArrivalTraceReader.cpp ^
+    src\utils\ExecutionProfileReader.cpp ^
+    src\utils\MeasurementReader.cpp ^
+    src\utils\SchedTraceReader.cpp ^
+    src\utils\TransactionReader.cpp ^
+    src\core\Scheduler.cpp ^
+    src\core\DispatchTable.cpp ^
+    src\servers\PollingServer.cpp ^
+    src\servers\DeferrableServer.cpp ^
+    src\experiments\BatchSimulator.cpp ^
+    src\experiments\TaskSetGenerator.cpp ^
+    src\experiments\ExperimentDriver.cpp ^
+    src\experiments\ProcessSweepExecutor.cpp ^
+    src\experiments\SweepCheckpoint.cpp ^
+    src\experiments\ArrivalGenerator.cpp ^
+    src\experiments\DistributedSimulator.cpp ^
+    src\experiments\MultiprocessorSimulator.cpp ^
+    src\experiments\ValidationExperiments.cpp ^
+    src\analysis\SchedulabilityAnalysis.cpp ^
+    src\analysis\AnalysisCache.cpp ^
+    src\analysis\IncrementalRTA.cpp ^
+    src\analysis\CyclicExecutive.cpp ^
+    src\analysis\ServerAnalysis.cpp ^
+    src\analysis\QueueingEstimator.cpp ^
+    src\analysis\ProbabilisticRTA.cpp ^
+    src\analysis\ExtremeValueFit.cpp ^
+    src\analysis\SchedTraceModel.cpp ^
+    src\analysis\HolisticAnalysis.cpp ^
+    src\service\AdmissionController.cpp ^
+    src\service\AdmissionServer.cpp
+
 REM Compile all source files
-echo [1/5] Compiling FileReader.cpp...
-g++ -c -std=c++17 -I include src/utils/FileReader.cpp -o build/FileReader.o
-if errorlevel 1 goto :error
+set OBJECTS=
+for %%F in (%SOURCES%) do (
+    echo Compiling %%~nxF...
+    g++ -c -std=c++17 -O2 -I include %%F -o build/%%~nF.o
+    if errorlevel 1 goto :error
+    set OBJECTS=!OBJECTS! build/%%~nF.o
+)
 
-echo [2/5] Compiling Scheduler.cpp...
-g++ -c -std=c++17 -I include src/core/Scheduler.cpp -o build/Scheduler.o
+echo Compiling main.cpp and linking...
+g++ -std=c++17 -O2 -I include src/main.cpp %OBJECTS% -o build/rt_scheduler.exe -pthread
 if errorlevel 1 goto :error
 
-echo [3/5] Compiling PollingServer.cpp...
-g++ -c -std=c++17 -I include src/servers/PollingServer.cpp -o build/PollingServer.o
+echo Compiling chart renderer...
+g++ -c -std=c++17 -O2 -I include src\utils\GanttRenderer.cpp -o build/GanttRenderer.o
 if errorlevel 1 goto :error
-
-echo [4/5] Compiling DeferrableServer.cpp...
-g++ -c -std=c++17 -I include src/servers/DeferrableServer.cpp -o build/DeferrableServer.o
+g++ -c -std=c++17 -O2 -I include src\utils\PngWriter.cpp -o build/PngWriter.o
 if errorlevel 1 goto :error
-
-echo [5/5] Compiling main.cpp and linking...
-g++ -std=c++17 -I include src/main.cpp build/FileReader.o build/Scheduler.o build/PollingServer.o build/DeferrableServer.o -o build/rt_scheduler.exe
+g++ -std=c++17 -O2 -I include src/render_main.cpp build/FileReader.o build/TracePyramid.o build/GanttRenderer.o build/PngWriter.o -o build/rt_render.exe
 if errorlevel 1 goto :error
 
 echo.
@@ -45,6 +83,7 @@ echo  BUILD SUCCESSFUL!
 echo ========================================
 echo.
 echo Executable: build\rt_scheduler.exe
+echo Chart renderer: build\rt_render.exe
 echo.
 echo To run: cd build ^&^& rt_scheduler.exe
 echo.
@@ -58,4 +97,3 @@ echo  BUILD FAILED!
 echo ========================================
 pause
 exit /b 1
-
@@ -0,0 +1,32 @@
+#pragma once
+#include "ISchedulingAlgorithm.h"
+#include "RateMonotonic.h"
+#include "DeadlineMonotonic.h"
+#include "EDF.h"
+#include "LeastSlackTime.h"
+
+// Same numbering as the interactive menu in main.cpp
+enum class AlgorithmKind {
+    RateMonotonic = 1,
+    DeadlineMonotonic = 2,
+    EDF = 3,
+    LeastSlackTime = 4
+};
+
+inline ISchedulingAlgorithm* createAlgorithm(AlgorithmKind kind) {
+    switch (kind) {
+        case AlgorithmKind::DeadlineMonotonic: return new DeadlineMonotonic();
+        case AlgorithmKind::EDF:               return new EDF();
+        case AlgorithmKind::LeastSlackTime:    return new LeastSlackTime();
+        default:                               return new RateMonotonic();
+    }
+}
+
+inline std::string shortName(AlgorithmKind kind) {
+    switch (kind) {
+        case AlgorithmKind::DeadlineMonotonic: return "DM";
+        case AlgorithmKind::EDF:               return "EDF";
+        case AlgorithmKind::LeastSlackTime:    return "LST";
+        default:                               return "RM";
+    }
+}
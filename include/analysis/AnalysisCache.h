@@ -0,0 +1,39 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include "../core/Task.h"
+#include "../algorithms/AlgorithmFactory.h"
+
+// Memoized SchedulabilityAnalysis for repeated runs on slowly changing task
+// sets (watch mode). Under fixed priorities a task's response time depends
+// only on its own (C, D) and the (C, T) of the tasks above it, so that is
+// the cache key: editing one task re-analyses it and the tasks below it,
+// everything above is a cache hit. The EDF/LST demand test is keyed on the
+// whole set.
+class AnalysisCache {
+public:
+    struct TaskVerdict {
+        int taskId;
+        int responseTime; // Ticks; -1 = deadline can be missed, 0 = not computed (EDF/LST)
+        int deadline;
+    };
+
+    struct Result {
+        bool schedulable;
+        std::vector<TaskVerdict> tasks; // Priority order (fixed priority only)
+    };
+
+    Result analyse(const std::vector<Task>& periodicTasks, AlgorithmKind kind,
+                   const std::string& serverPolicy);
+
+    // Statistics of the last analyse()
+    size_t hitCount() const { return hits; }
+    size_t computedCount() const { return computed; }
+
+private:
+    std::unordered_map<std::string, int> responseTimes;
+    std::unordered_map<std::string, bool> demandTests;
+    size_t hits = 0;
+    size_t computed = 0;
+};
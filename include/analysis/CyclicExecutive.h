@@ -0,0 +1,29 @@
+#pragma once
+#include <vector>
+#include <string>
+#include "../core/Task.h"
+#include "../core/DispatchTable.h"
+
+// Offline cyclic-executive synthesis: a table of equal frames over one major
+// cycle (the hyperperiod), with the jobs assigned to frames by max flow.
+class CyclicExecutive {
+public:
+    struct Result {
+        bool feasible = false;
+        std::string reason;        // Why no table was produced
+        int hyperperiod = 0;       // Ticks
+        int frameSize = 0;         // Ticks
+        int jobs = 0;
+        int splitJobs = 0;         // Jobs run in more than one frame
+        int framesTried = 0;
+        std::vector<int> candidates; // Frame sizes meeting the constraints, in trial order
+        DispatchTable table;       // One step per frame
+    };
+
+    // Largest hyperperiod (ticks) a table is built for
+    static const int MAX_CYCLE = 1000000;
+
+    static Result synthesize(const std::vector<Task>& periodicTasks);
+
+    static std::vector<int> frameCandidates(const std::vector<Task>& tasks, int hyperperiod);
+};
@@ -0,0 +1,71 @@
+#pragma once
+#include <vector>
+#include <queue>
+#include <functional>
+
+// Measurement-based probabilistic WCET (pWCET) for one task: the execution
+// time exceeded with a chosen per-job probability, extrapolated from the
+// tail of measured samples by extreme-value theory. Samples are streamed
+// through add() in O(1) / O(log K) each, in constant memory:
+//  - block maxima: the maximum of every `blockSize` consecutive samples
+//    is Gumbel distributed; location and scale come from the moments of
+//    the block maxima (running mean and variance);
+//  - peaks over threshold: the K largest samples are kept in a min-heap;
+//    the excesses over the smallest of them follow a generalised Pareto
+//    distribution, fitted by probability-weighted moments (Hosking &
+//    Wallis 1987), which also covers bounded (shape < 0) tails.
+// Units are whatever the samples are in.
+class ExtremeValueFit {
+public:
+    struct Gumbel {
+        bool valid;       // At least MIN_BLOCKS complete blocks, some spread
+        double location;
+        double scale;
+        int blockSize;
+
+        // Execution time exceeded by one job with probability p
+        double quantile(double p) const;
+    };
+
+    struct Gpd {
+        bool valid;        // At least MIN_TAIL excesses, positive scale
+        double threshold;
+        double scale;
+        double shape;      // xi; > 0 heavy tail, < 0 bounded
+        double tailFraction; // Share of samples above the threshold
+
+        double quantile(double p) const;
+    };
+
+    static const int MIN_BLOCKS = 10;
+    static const int MIN_TAIL = 30;
+
+    explicit ExtremeValueFit(int blockSize = 100, size_t tailSize = 1000);
+
+    void add(double value);
+
+    long long count() const { return samples; }
+    double maximum() const { return highest; }
+
+    Gumbel gumbel() const;
+    Gpd gpd() const;
+
+    // The larger of the valid fits (never below the observed maximum);
+    // the observed maximum if neither fit is valid
+    double pwcet(double p) const;
+
+private:
+    int blockSize;
+    size_t tailSize;
+    long long samples;
+    double highest;
+
+    // Block maxima: current block and running moments (Welford)
+    double blockMax;
+    int blockFill;
+    long long blocks;
+    double maxMean;
+    double maxM2;
+
+    std::priority_queue<double, std::vector<double>, std::greater<double>> tail;
+};
@@ -0,0 +1,45 @@
+#pragma once
+#include <vector>
+#include "../core/Transaction.h"
+
+// Holistic end-to-end analysis of a DistributedSystem (Tindell & Clark).
+// Every step is analysed on its node as a task with release jitter: it is
+// released between its best case (earliest completion of the step before
+// it plus the shortest latency) and its worst case (latest completion plus
+// the longest latency). Local response times depend on the jitter of the
+// other tasks on the node, and jitter on the response times upstream, so
+// the two are iterated to a fixed point.
+//
+// Local bounds: RM / DM by busy-window response-time analysis with jitter
+// (equal priorities counted as higher); EDF / LST by the longest busy
+// period on the node, which bounds every job of a work-conserving policy.
+// Precedence and offsets between steps of one transaction are ignored,
+// which keeps the bounds safe but pessimistic.
+class HolisticAnalysis {
+public:
+    struct StepBound {
+        int transaction;
+        size_t step;
+        int taskId;
+        int node;
+        int offset;   // Earliest release after the transaction release (ticks)
+        int jitter;   // Latest minus earliest release
+        int response; // Latest completion after the transaction release, -1 = unbounded
+    };
+
+    struct Result {
+        std::vector<StepBound> steps;   // In transaction / step order
+        std::vector<int> endToEnd;      // Per transaction, -1 = unbounded
+        int iterations = 0;
+        bool schedulable = false;       // Every end-to-end bound within its deadline
+    };
+
+    static Result analyse(const DistributedSystem& system);
+
+    // The usual per-node test (SchedulabilityAnalysis) with every step as an
+    // independent periodic task with its local deadline: no jitter, no
+    // end-to-end view
+    static bool nodeTest(const DistributedSystem& system, const NodeSpec& node);
+
+    static double nodeUtilization(const DistributedSystem& system, int node);
+};
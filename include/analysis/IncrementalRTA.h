@@ -0,0 +1,83 @@
+#pragma once
+#include <vector>
+#include "../core/Task.h"
+#include "../algorithms/AlgorithmFactory.h"
+
+// Response-time analysis (RM / DM) kept up to date under task set changes.
+//
+// Tasks are held in priority order with their converged response times.
+// A change at priority level k never affects the levels above k, so only
+// k and below are recomputed, and each of those restarts from a bound it
+// already has instead of from scratch:
+//  - more interference (add, WCET increase by D): every window gains at
+//    least D ticks of demand, so the old response time plus D is a lower
+//    bound of the new least fixed point and iteration resumes there;
+//  - less interference (remove, WCET decrease): the fixed point can only
+//    move down, so the level restarts from C_i + sum of C_hp.
+// Self-suspending levels interfere with jitter R - C taken from their own
+// entry (SchedulabilityAnalysis::interferenceJitter); it only grows with
+// more interference, so both bounds still hold.
+// Ties in priority go to the task that was added first, except that a
+// server always goes after the tasks (StaticAnalysis::precedes), which
+// matches SchedulabilityAnalysis::priorityOrder on the tasks listed in
+// insertion order plus the server.
+class IncrementalRTA {
+public:
+    struct Entry {
+        Task task;
+        int responseTime; // Ticks; -1 = exceeds the deadline
+    };
+
+    explicit IncrementalRTA(AlgorithmKind kind);
+
+    void addTask(const Task& task);
+    bool removeTask(int taskId);
+    bool updateWCET(int taskId, int computationTime);
+
+    // Would every deadline still hold with `task` added? The task is inserted
+    // tentatively, the levels at and below it are re-solved, and everything
+    // is rolled back, so the analysis is left as it was. Fills the ids of
+    // tasks that would miss (the candidate included) and the candidate's
+    // response time (-1 if it misses). The results are kept, so an addTask()
+    // of the same task right after costs no iterations.
+    bool admits(const Task& task, std::vector<int>& violations, int& responseTime);
+
+    bool schedulable() const { return missing == 0; }
+    const std::vector<Entry>& entries() const { return levels; }
+    int responseTime(int taskId) const;
+
+    // Fixed-point iterations spent by the last operation
+    long long iterations() const { return lastIterations; }
+
+private:
+    AlgorithmKind kind;
+    std::vector<Entry> levels; // Highest priority first
+    int missing;
+    long long version; // Bumped on every change, validates `probe`
+    mutable long long lastIterations;
+
+    // Last admits() result: response of the candidate, then of each level below it
+    struct {
+        Task task;
+        long long version;
+        std::vector<int> responses;
+    } probe;
+    std::vector<int> saved; // admits(): response times to roll back to
+
+    bool higherPriority(const Task& a, const Task& b) const;
+    int indexOf(int taskId) const;
+
+    // Response time of `task` under levels[0..hpCount): least fixed point of
+    // the first job's window, iterating from `start` (must be a lower bound),
+    // then the later jobs of the busy window if it is still open when the
+    // next one arrives. Returns -1 past the deadline.
+    int solve(const Task& task, size_t hpCount, long long start) const;
+    long long lowerBound(const Task& task, size_t hpCount) const;
+    // Start for the first window of levels[...] after `added` more demand
+    long long resumeFrom(const Entry& e, size_t hpCount, int added) const;
+    size_t insertionPoint(const Task& task) const;
+
+    // Re-solve levels from..end. `added` > 0: each of them gained that much
+    // demand per window (old values are lower bounds); 0: demand went down.
+    void recompute(size_t from, int added);
+};
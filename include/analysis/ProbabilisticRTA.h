@@ -0,0 +1,52 @@
+#pragma once
+#include <vector>
+#include <map>
+#include <string>
+#include "../core/Task.h"
+#include "../algorithms/AlgorithmFactory.h"
+#include "../utils/ExecutionProfileReader.h"
+
+// Probabilistic response-time analysis for fixed priorities (RM / DM): the
+// response-time distribution and deadline-miss probability of each task's
+// first job at the critical instant, from its execution-time distribution.
+class ProbabilisticRTA {
+public:
+    // p[k] = probability of completing at k * step ticks (rounded up);
+    // overflow = probability of completing after the deadline
+    struct Distribution {
+        int step = 1;
+        std::vector<double> p;
+        double overflow = 0;
+
+        // Smallest time (ticks) with P(R <= t) >= q; -1 if only past the deadline
+        int quantile(double q) const;
+    };
+
+    struct Result {
+        int taskId;
+        int deadline;        // Ticks
+        Distribution response;
+        double missTarget;   // -1 = none given
+        bool meetsTarget;    // missProbability() <= missTarget (true without a target)
+        int convolutions;
+        int fftConvolutions;
+
+        double missProbability() const { return response.overflow; }
+    };
+
+    static const int DEFAULT_MAX_POINTS = 4096;
+
+    // False (with the reason) when a task has a deadline past its period or
+    // a release jitter
+    static bool validate(const std::vector<Task>& tasks, std::string& error);
+
+    // Tasks with the server included (SchedulabilityAnalysis::withServer);
+    // tasks without a profile are deterministic at computationTime. Empty
+    // when validate() rejects the tasks.
+    static std::vector<Result> analyse(const std::vector<Task>& tasks, AlgorithmKind kind,
+                                       const std::map<int, ExecutionProfileReader::Profile>& profiles,
+                                       int maxPoints = DEFAULT_MAX_POINTS);
+
+    // Linear convolution; by FFT when both inputs are long
+    static std::vector<double> convolve(const std::vector<double>& a, const std::vector<double>& b, bool& usedFft);
+};
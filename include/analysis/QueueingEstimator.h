@@ -0,0 +1,37 @@
+#pragma once
+#include <vector>
+#include <string>
+#include "../core/Task.h"
+#include "../algorithms/AlgorithmFactory.h"
+
+// Fast approximation of the aperiodic response time under a server policy
+// (M/G/1 queue with the periodic work as vacations, no simulation), meant
+// to rank candidates; --experiment --mode queueing checks it.
+class QueueingEstimator {
+public:
+    struct Workload {
+        double rate;         // Arrivals per tick
+        double meanExec;     // E[S], ticks
+        double secondMoment; // E[S^2], ticks^2
+    };
+
+    struct Estimate {
+        bool stable;         // rho < 1
+        double load;         // rho
+        double meanResponse; // Ticks (infinite if unstable)
+        double queueWait;    // W, ticks (queue plus residual vacations)
+        double service;      // Mean time from the head of the queue to completion, ticks
+        double variance;     // Of the response time, ticks^2
+
+        // p in (0, 1); ticks (infinite if unstable)
+        double percentile(double p) const;
+    };
+
+    static Estimate estimate(const Workload& workload, const std::string& policy,
+                             const std::vector<Task>& periodicTasks, AlgorithmKind kind,
+                             int capacity, int period);
+
+    // Rate and moments of the A lines of an input file (rate over the span
+    // of their releases); rate 0 for fewer than two arrivals
+    static Workload fromArrivals(const std::vector<Task>& aperiodicTasks);
+};
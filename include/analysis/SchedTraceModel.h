@@ -0,0 +1,79 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <cstdint>
+#include "../utils/SchedTraceReader.h"
+
+// Per-thread jobs rebuilt from a stream of sched_switch / sched_wakeup
+// events, and task parameters derived from them.
+//
+// A job of a thread is released when it is woken (or, with no wakeup seen,
+// when it is first switched in), runs over one or more switch-in/out
+// intervals on any CPU, and completes when it is switched out blocked
+// (prev_state other than R / R+); switched out runnable it was preempted.
+// Execution is the time spent switched in, response the time from release
+// to completion. Period is the median gap between releases.
+//
+// Per thread only summaries and the first JOB_LOG_LIMIT jobs (for the
+// timeline comparison) are kept, and at most GAP_SAMPLES release gaps for
+// the median, so memory does not grow with the trace.
+class SchedTraceModel {
+public:
+    struct Job {
+        uint64_t release;   // ns
+        uint64_t start;
+        uint64_t finish;
+        uint64_t execution;
+    };
+
+    struct Thread {
+        int pid = 0;
+        std::string comm;
+        long long jobs = 0;
+        uint64_t maxExecution = 0;
+        double sumExecution = 0;
+        uint64_t maxResponse = 0;
+        double sumResponse = 0;
+        uint64_t firstRelease = 0;
+        std::vector<uint64_t> gaps; // Release gaps, first GAP_SAMPLES
+        std::vector<Job> log;       // First JOB_LOG_LIMIT jobs
+
+        uint64_t period() const;    // Median gap, 0 with fewer than two jobs
+        double meanExecution() const { return jobs ? sumExecution / jobs : 0; }
+        double meanResponse() const { return jobs ? sumResponse / jobs : 0; }
+    };
+
+    static const size_t JOB_LOG_LIMIT = 100000;
+    static const size_t GAP_SAMPLES = 65536;
+
+    void add(const SchedTraceReader::Event& event);
+
+    uint64_t firstTimestamp() const { return first; }
+    uint64_t lastTimestamp() const { return last; }
+
+    // Threads with at least minJobs completed jobs, most jobs first (the
+    // idle task, pid 0, is never a thread)
+    std::vector<const Thread*> threads(long long minJobs) const;
+
+private:
+    struct Open {
+        bool active = false;   // A job is released and not completed
+        bool running = false;
+        uint64_t release = 0;
+        uint64_t start = 0;
+        uint64_t runSince = 0;
+        uint64_t execution = 0;
+        uint64_t lastRelease = 0;
+        bool released = false; // lastRelease is valid
+    };
+
+    std::unordered_map<int, Thread> byPid;
+    std::unordered_map<int, Open> open;
+    uint64_t first = 0;
+    uint64_t last = 0;
+    bool seen = false;
+
+    void release(int pid, uint64_t t);
+    void complete(int pid, Open& state, uint64_t t);
+};
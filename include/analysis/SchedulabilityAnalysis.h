@@ -0,0 +1,70 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <algorithm>
+#include "../core/Task.h"
+#include "StaticAnalysis.h"
+#include "../algorithms/AlgorithmFactory.h"
+
+// Exact uniprocessor tests on the tick-scaled task model.
+// The server (when the policy is Poller/Deferrable) is analysed as the
+// periodic task the Scheduler adds for it: SERVER_CAPACITY every SERVER_PERIOD.
+// A Deferrable server can run its budget at the end of one period and again
+// at the start of the next (back-to-back), so it interferes like a task
+// with release jitter T - C. Other tasks carry their own release jitter
+// (Task::jitter); their response times count from the nominal release and
+// deadlines may exceed periods.
+//
+// Self-suspending tasks (Task::segments) are analysed suspension-aware
+// under fixed priorities: a job's own suspension adds to its own response
+// time only, and a self-suspending higher priority task interferes like a
+// task with release jitter R - C, since its execution can be pushed
+// anywhere in its response window (treating its suspension as idle time
+// and nothing more is unsafe; as computation, wasteful). EDF / LST have no
+// such analysis here and fall back to suspension as computation.
+//
+// The busy-window and demand computations themselves live in
+// StaticAnalysis (constexpr); this class sorts, adds the server and
+// precomputes the interference jitter.
+class SchedulabilityAnalysis {
+public:
+    // Periodic tasks plus the server task for the given policy (typed
+    // TaskType::Poller / TaskType::DeferrableServer)
+    static std::vector<Task> withServer(const std::vector<Task>& periodicTasks,
+                                        const std::string& serverPolicy);
+
+    // Release jitter a task interferes with (ticks)
+    static int releaseJitter(const Task& task) { return StaticAnalysis::releaseJitter(task); }
+
+    // Release jitter a higher priority task interferes with, given its
+    // response time (ticks; only used if the task self-suspends)
+    static int interferenceJitter(const Task& task, int responseTime) {
+        return (int)StaticAnalysis::interferenceJitter(task, responseTime);
+    }
+
+    // Tasks sorted highest priority first (RM: period, DM: deadline). Ties
+    // keep the listed order, except that the server goes after the tasks
+    // (StaticAnalysis::precedes).
+    static std::vector<Task> priorityOrder(const std::vector<Task>& tasks, AlgorithmKind kind);
+
+    // Worst-case response time of tasks[index] given tasks[0..index-1] have
+    // higher priority. Returns -1 if it exceeds the limit (unschedulable).
+    // Every job in the level-i busy window is checked (q = 0, 1, ... until
+    // the window closes before the next release), which matters once the
+    // deadline or the jitter lets a job still run when the next arrives.
+    // A self-suspending task must finish before its next release (-1
+    // otherwise), and one above it that misses its deadline makes it -1.
+    static int responseTime(const std::vector<Task>& byPriority, size_t index, int limit);
+
+    // Response-time analysis for fixed priorities (RM / DM)
+    static bool fixedPriorityTest(const std::vector<Task>& tasks, AlgorithmKind kind);
+
+    // Processor-demand test for EDF (also used for LST, which is optimal on
+    // one processor as well); suspension counts as computation
+    static bool demandBoundTest(const std::vector<Task>& tasks);
+
+    static bool isSchedulable(const std::vector<Task>& periodicTasks, AlgorithmKind kind,
+                              const std::string& serverPolicy);
+
+    static double utilization(const std::vector<Task>& tasks);
+};
@@ -0,0 +1,46 @@
+#pragma once
+#include <vector>
+#include <string>
+#include "../core/Task.h"
+#include "../algorithms/AlgorithmFactory.h"
+
+// Worst-case response bounds for aperiodic work served by the Polling and
+// Deferrable servers, from the server's capacity Cs and period Ts.
+//
+// A demand of q ticks (the job plus any backlog queued ahead of it) needs
+// k = ceil(q / Cs) server periods, the last one serving r = q - (k-1) Cs.
+// Let Rs(x) be the response time of a server job with budget x among the
+// tasks of higher priority (RTA for RM/DM; Ts under EDF/LST, where each
+// server job meets its period end whenever the set passes the demand test).
+//  - Polling: the job can arrive just after a poll found the queue empty,
+//    so service starts at the next release at the latest:
+//        R <= k Ts + Rs(r)
+//  - Deferrable: the budget is kept, and an empty budget means at least Cs
+//    of the period has gone by. When the server has the highest priority
+//    that saves Cs of waiting:
+//        R <= k Ts - Cs + Rs(r)
+//    Below other tasks, budget left at arrival may still expire unused, so
+//    the Polling bound applies.
+// The server must itself be schedulable (Rs(Cs) <= Ts), otherwise there is
+// no bound. The Deferrable back-to-back effect on the periodic tasks is
+// covered by SchedulabilityAnalysis (release jitter Ts - Cs).
+class ServerAnalysis {
+public:
+    struct Bound {
+        int serverResponse; // Rs(Cs), ticks; -1 = the server can overrun its period
+        int periods;        // k
+        int responseTime;   // Ticks; -1 = no bound
+    };
+
+    static Bound aperiodicBound(const std::vector<Task>& periodicTasks, AlgorithmKind kind,
+                                const std::string& policy, int work, int capacity, int period);
+
+    // Smallest capacity (ticks) at the given period that keeps the periodic
+    // tasks schedulable and bounds the response of `work` by `target`; -1 if none
+    static int minimumCapacity(const std::vector<Task>& periodicTasks, AlgorithmKind kind,
+                               const std::string& policy, int work, int period, int target);
+
+    // Periodic tasks plus a server task of the given shape (typed by policy)
+    static std::vector<Task> withServer(const std::vector<Task>& periodicTasks, const std::string& policy,
+                                        int capacity, int period);
+};
@@ -0,0 +1,199 @@
+#pragma once
+#include <cstddef>
+#include "../core/Task.h"
+
+// Compile-time (constexpr, header-only) versions of the SchedulabilityAnalysis
+// tests, e.g. static_assert(StaticAnalysis::deadlineMonotonic(TASKS), "...").
+// SchedulabilityAnalysis calls them too, so both verdicts always agree.
+class StaticAnalysis {
+public:
+    // How priorities are read off the table: by period (RM), by deadline
+    // (DM), or already sorted highest first
+    enum class Priority { Period, Deadline, Listed };
+
+    // Worst-case response time of tasks[index] under fixed priorities by
+    // period (RM) or by deadline (DM); -1 if it exceeds the deadline.
+    // Checks every job of the level-i busy window and handles
+    // self-suspending tasks (see SchedulabilityAnalysis).
+    static constexpr long long responseTime(const Task* tasks, size_t count, size_t index, bool byDeadline) {
+        Priority priority = byDeadline ? Priority::Deadline : Priority::Period;
+        return busyWindow(tasks, count, index, priority, tasks[index].relativeDeadline,
+                          [tasks, count, priority](size_t j) {
+                              return interferenceJitter(tasks, count, j, priority);
+                          });
+    }
+
+    // Level-i busy window of tasks[index]: every job q = 0, 1, ... until the
+    // window closes before the next release. `hpJitter(j)` is the release
+    // jitter tasks[j] interferes with, -1 if it self-suspends and misses.
+    // Returns -1 once a response exceeds `limit`.
+    template <typename HpJitter>
+    static constexpr long long busyWindow(const Task* tasks, size_t count, size_t index, Priority priority,
+                                          long long limit, HpJitter hpJitter) {
+        const Task& task = tasks[index];
+        long long ownJitter = task.jitter; // A server's back-to-back only affects others
+        long long suspension = task.suspensionTime();
+
+        long long hpWork = 0;
+        double load = task.period > 0 ? (double)task.computationTime / task.period : 0.0;
+        bool jittered = ownJitter > 0;
+        for (size_t j = 0; j < count; j++) {
+            if (!higherPriority(tasks, j, index, priority)) continue;
+            hpWork += tasks[j].computationTime;
+            if (tasks[j].period > 0) load += (double)tasks[j].computationTime / tasks[j].period;
+            long long jitter = hpJitter(j);
+            if (jitter < 0) return -1; // A self-suspending task above misses
+            if (jitter > 0) jittered = true;
+        }
+        // Same as the demand test: with jitter at full load the window never closes
+        if (jittered && task.period > 0 && load > 1.0 - 1e-9) return -1;
+
+        long long worst = 0;
+        for (long long q = 0;; q++) {
+            // Busy window of q + 1 jobs. Start from all of their work plus one
+            // job of every higher priority task (a valid lower bound).
+            long long w = (q + 1) * task.computationTime + suspension + hpWork;
+            while (true) {
+                if (w - q * task.period + ownJitter > limit) return -1;
+                long long next = (q + 1) * task.computationTime + suspension;
+                for (size_t j = 0; j < count; j++) {
+                    if (!higherPriority(tasks, j, index, priority)) continue;
+                    const Task& hp = tasks[j];
+                    if (hp.period <= 0) { next += hp.computationTime; continue; }
+                    next += ((w + hpJitter(j) + hp.period - 1) / hp.period) * hp.computationTime;
+                }
+                if (next == w) break;
+                w = next;
+            }
+            long long r = w - q * task.period + ownJitter;
+            if (r > worst) worst = r;
+            if (task.period <= 0 || w + ownJitter <= (q + 1) * task.period) return worst;
+            // The processor idles while a job is suspended, so a busy window of
+            // several jobs says nothing; only jobs done before the next release
+            // are covered
+            if (suspension > 0) return -1;
+        }
+    }
+
+    static constexpr bool fixedPriorityTest(const Task* tasks, size_t count, bool byDeadline) {
+        for (size_t i = 0; i < count; i++) {
+            if (responseTime(tasks, count, i, byDeadline) < 0) return false;
+        }
+        return true;
+    }
+
+    // Processor-demand test (EDF, and LST which is optimal as well);
+    // suspension counts as computation
+    static constexpr bool demandBoundTest(const Task* tasks, size_t count) {
+        double u = 0.0;
+        bool implicit = true, jittered = false;
+        for (size_t i = 0; i < count; i++) {
+            if (tasks[i].period <= 0) continue;
+            u += (double)demand(tasks[i]) / tasks[i].period;
+            if (tasks[i].relativeDeadline < tasks[i].period) implicit = false;
+            if (releaseJitter(tasks[i]) > 0) jittered = true;
+        }
+        if (u > 1.0 + 1e-9) return false;
+        if (implicit && !jittered) return true;
+        if (jittered && u > 1.0 - 1e-9) return false; // Busy period never closes
+
+        // Synchronous busy period: every missed deadline happens inside it
+        long long busy = 0;
+        for (size_t i = 0; i < count; i++) busy += demand(tasks[i]);
+        while (true) {
+            long long next = 0;
+            for (size_t i = 0; i < count; i++) {
+                const Task& t = tasks[i];
+                if (t.period <= 0) { next += demand(t); continue; }
+                next += ((busy + releaseJitter(t) + t.period - 1) / t.period) * demand(t);
+            }
+            if (next == busy) break;
+            busy = next;
+        }
+
+        // dbf(t) <= t at every absolute deadline inside the busy period
+        for (size_t c = 0; c < count; c++) {
+            long long step = tasks[c].period > 0 ? tasks[c].period : busy + 1;
+            long long first = tasks[c].relativeDeadline - releaseJitter(tasks[c]);
+            for (long long d = first < 0 ? 0 : first; d <= busy; d += step) {
+                long long total = 0;
+                for (size_t i = 0; i < count; i++) {
+                    const Task& t = tasks[i];
+                    long long window = d + releaseJitter(t) - t.relativeDeadline;
+                    if (window < 0) continue;
+                    long long jobs = t.period > 0 ? window / t.period + 1 : 1;
+                    total += jobs * demand(t);
+                }
+                if (total > d) return false;
+            }
+        }
+        return true;
+    }
+
+    template <size_t N>
+    static constexpr bool rateMonotonic(const Task (&tasks)[N]) { return fixedPriorityTest(tasks, N, false); }
+
+    template <size_t N>
+    static constexpr bool deadlineMonotonic(const Task (&tasks)[N]) { return fixedPriorityTest(tasks, N, true); }
+
+    template <size_t N>
+    static constexpr bool edf(const Task (&tasks)[N]) { return demandBoundTest(tasks, N); }
+
+    template <size_t N>
+    static constexpr long long responseTime(const Task (&tasks)[N], size_t index, bool byDeadline) {
+        return responseTime(tasks, N, index, byDeadline);
+    }
+
+    // Release jitter a task interferes with (ticks): a Deferrable server can
+    // run its budget back-to-back across a period boundary, so T - C; any
+    // other task its own release jitter
+    static constexpr int releaseJitter(const Task& task) {
+        return task.type == TaskType::DeferrableServer ? task.period - task.computationTime : task.jitter;
+    }
+
+    // Release jitter a higher priority task interferes with, given its
+    // response time (only used if the task self-suspends)
+    static constexpr long long interferenceJitter(const Task& task, long long responseTime) {
+        if (!task.selfSuspending()) return releaseJitter(task);
+        long long jitter = responseTime - task.computationTime;
+        return jitter > releaseJitter(task) ? jitter : releaseJitter(task);
+    }
+
+    // Strict priority order of RM (period) / DM (deadline). On equal keys a
+    // server goes after the tasks, as withServer() lists it; otherwise
+    // neither precedes and the listing order decides
+    static constexpr bool precedes(const Task& a, const Task& b, bool byDeadline) {
+        int ka = byDeadline ? a.relativeDeadline : a.period;
+        int kb = byDeadline ? b.relativeDeadline : b.period;
+        if (ka != kb) return ka < kb;
+        return !isServer(a) && isServer(b);
+    }
+
+    // Does tasks[j] preempt tasks[i]? Equal priority: the earlier entry wins
+    static constexpr bool higherPriority(const Task* tasks, size_t j, size_t i, Priority priority) {
+        if (j == i) return false;
+        if (priority == Priority::Listed) return j < i;
+        bool byDeadline = priority == Priority::Deadline;
+        if (precedes(tasks[j], tasks[i], byDeadline)) return true;
+        return !precedes(tasks[i], tasks[j], byDeadline) && j < i;
+    }
+
+private:
+    // interferenceJitter of tasks[j], deriving its response time when it
+    // self-suspends; -1 if it then misses its deadline
+    static constexpr long long interferenceJitter(const Task* tasks, size_t count, size_t j, Priority priority) {
+        if (!tasks[j].selfSuspending()) return releaseJitter(tasks[j]);
+        long long r = busyWindow(tasks, count, j, priority, tasks[j].relativeDeadline,
+                                 [tasks, count, priority](size_t k) {
+                                     return interferenceJitter(tasks, count, k, priority);
+                                 });
+        return r < 0 ? -1 : interferenceJitter(tasks[j], r);
+    }
+
+    static constexpr bool isServer(const Task& task) {
+        return task.type == TaskType::Poller || task.type == TaskType::DeferrableServer;
+    }
+
+    // Work of one job for the demand test
+    static constexpr long long demand(const Task& task) { return task.computationTime + task.suspensionTime(); }
+};
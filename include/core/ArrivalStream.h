@@ -0,0 +1,42 @@
+#pragma once
+#include <vector>
+#include <algorithm>
+#include "Task.h"
+
+// Source of aperiodic arrivals for the Scheduler, consumed in release order
+// through a cursor: the simulation asks for the next arrival only once the
+// previous one has been released, so a trace or generator never has to be
+// held in memory as a whole.
+class ArrivalStream {
+public:
+    virtual ~ArrivalStream() = default;
+
+    // Next arrival (tick-scaled Task, type Aperiodic). False at the end.
+    virtual bool next(Task& task) = 0;
+
+    // Latest release in the stream in ticks if known up front (sizes the
+    // simulation), -1 otherwise
+    virtual int lastRelease() const { return -1; }
+};
+
+// Arrivals listed in the input file (aperiodicTasks), sorted by release;
+// equal releases keep their file order
+class VectorArrivalStream : public ArrivalStream {
+public:
+    explicit VectorArrivalStream(std::vector<Task> tasks) : tasks(std::move(tasks)), cursor(0) {
+        std::stable_sort(this->tasks.begin(), this->tasks.end(),
+                         [](const Task& a, const Task& b) { return a.releaseTime < b.releaseTime; });
+    }
+
+    bool next(Task& task) override {
+        if (cursor >= tasks.size()) return false;
+        task = tasks[cursor++];
+        return true;
+    }
+
+    int lastRelease() const override { return tasks.empty() ? -1 : tasks.back().releaseTime; }
+
+private:
+    std::vector<Task> tasks;
+    size_t cursor;
+};
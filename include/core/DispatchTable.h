@@ -0,0 +1,75 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// Time-triggered schedule for one cycle (a hyperperiod), replayed forever.
+//
+// The cycle is a sequence of steps, each step running one block from its
+// start time. A block is a short list of slots (offset in the block, task,
+// duration). Identical stretches of the schedule - cyclic-executive frames,
+// repeated patterns in a simulated hyperperiod - are stored once as a block
+// and referenced by several steps. Gaps between slots are idle time.
+//
+// When every step is one fixed-length frame (cyclic executive), frameSize
+// is that length and step k starts at k * frameSize, so a dispatcher finds
+// the current step with one division; otherwise frameSize is 0.
+//
+// Binary layout (little-endian, all fields u32 unless noted):
+//   "RTDT1\0\0\0", cycle length, ticks per unit, frame size,
+//   block count, slot count, step count
+//   blocks x { length, first slot, slot count }
+//   slots  x { offset, i32 task id, duration }
+//   steps  x { start, block }
+class DispatchTable {
+public:
+    struct Slot {
+        uint32_t offset;
+        int32_t taskId;
+        uint32_t duration;
+    };
+
+    struct Block {
+        uint32_t length;
+        uint32_t firstSlot;
+        uint32_t slotCount;
+    };
+
+    struct Step {
+        uint32_t start;
+        uint32_t block;
+    };
+
+    uint32_t cycleLength = 0;
+    uint32_t ticksPerUnit = 10;
+    uint32_t frameSize = 0;
+    std::vector<Block> blocks;
+    std::vector<Slot> slots;
+    std::vector<Step> steps;
+
+    // Table for a per-tick timeline (task id per tick, -1 = idle) repeated
+    // every timeline.size() ticks. Runs of a task become slots; the timeline
+    // is cut into equal frames and identical frames share a block. Every
+    // frame length dividing the cycle is tried and the smallest encoding
+    // kept, so periodic patterns (one per minor cycle, say) collapse to a
+    // few blocks while a schedule without repeats ends up as one block.
+    static DispatchTable compile(const std::vector<int32_t>& timeline, uint32_t ticksPerUnit);
+
+    // Size of the binary encoding
+    size_t encodedSize() const { return 32 + 12 * blocks.size() + 12 * slots.size() + 8 * steps.size(); }
+
+    // Appends a block unless an identical one exists; returns its index
+    uint32_t addBlock(uint32_t length, const std::vector<Slot>& blockSlots);
+
+    // Task running at tick t of the cycle (-1 = idle). Binary search, for checks.
+    int taskAt(uint32_t t) const;
+
+    // Busy ticks per task over one cycle
+    std::vector<std::pair<int, uint32_t>> busyTicks() const;
+
+    bool writeBinary(const std::string& path) const;
+    static bool readBinary(const std::string& path, DispatchTable& table);
+
+    // C++ header with the table as constexpr arrays in namespace `name`
+    bool writeHeader(const std::string& path, const std::string& name, const std::string& comment) const;
+};
@@ -1,10 +1,44 @@
 #pragma once
 #include <vector>
+#include <deque>
 #include <string>
+#include <memory>
+#include <unordered_set>
+#include <atomic>
+#include <functional>
+#include <cstdint>
 #include "Task.h"
 #include "Job.h"
+#include "ArrivalStream.h"
 #include "../algorithms/ISchedulingAlgorithm.h"
 
+// --- CONFIGURATION (SCALED FOR 0.1 QUANTUM) ---
+// 1 Unit = 10 Ticks. 
+// Server Capacity 2.0 -> 20 ticks
+// Server Period 5.0 -> 50 ticks
+const int SERVER_CAPACITY = 20; 
+const int SERVER_PERIOD = 50;
+const int SERVER_TASK_ID = 999;
+const int SAFETY_LIMIT = 10000; // Increased limit for higher tick count
+const int TRACE_LIMIT = 100000000; // Run length when replaying an arrival trace (10M units)
+
+// Snapshot passed to the progress callback while run() is going
+struct ProgressInfo {
+    int tick;
+    int hyperperiod;
+    size_t events;
+    int misses;
+};
+
+// How the release jitter of periodic tasks (Task::jitter) is played out.
+// Deadlines always count from the nominal release r + k p.
+enum class JitterMode {
+    FirstDelayed, // First job as late as the jitter allows, the rest on time:
+                  // the critical instant of the analysis for the first busy
+                  // window only, not a worst case for later jobs
+    Random        // Every job delayed uniformly in [0, J], from a seeded stream
+};
+
 // Forward declaration to avoid circular includes
 // (We only need the pointer type here, the implementation is in the .cpp)
 class IServer; 
@@ -22,12 +56,51 @@ private:
     std::vector<Task> aperiodicTasks;
     
     std::vector<Job*> readyQueue;      // Main queue (P jobs + Server job)
-    std::vector<Job*> aperiodicQueue;  // Waiting area for A jobs
+    std::deque<Job*> aperiodicQueue;   // Waiting area for A jobs (FIFO)
+
+    // Aperiodic arrivals come through a cursor; released tasks live in
+    // streamedTasks until their job has left the (FIFO) aperiodic queue
+    std::unique_ptr<ArrivalStream> defaultArrivals;
+    ArrivalStream* arrivals;
+    std::deque<Task> streamedTasks;
+    std::unordered_set<int> periodicIds; // describe() lookups
+    std::vector<int> aperiodicResponses;  // Ticks from arrival to completion, in completion order
 
     ISchedulingAlgorithm* algorithm;
     int hyperperiod;
     std::string serverPolicy;
 
+    bool verbose;         // Console log + ABORTED export (off for sweeps)
+    bool recordHistory;   // Keep the timeline (off for long workload runs)
+    bool deadlineMissed;
+    int ticksSimulated;
+
+    // Run state, kept between advance() calls
+    int jobCounter;
+    Task pendingArrival;
+    bool hasPendingArrival;
+    bool started;
+
+    // Sporadic jobs from releaseJob() and delayed (jittered) periodic
+    // jobs, a min-heap on arrival time
+    std::vector<Job*> pendingReleases;
+    JitterMode jitterMode;
+    uint64_t jitterSeed;
+    // Self-suspended jobs (off the ready queue), a min-heap on the tick
+    // they come back
+    struct Suspension {
+        int resume;
+        Job* job;
+    };
+    std::vector<Suspension> suspendedJobs;
+    std::function<void(const Job&)> completionCallback;
+
+    // Progress reporting / cancellation (interactive UI)
+    std::function<void(const ProgressInfo&)> progressCallback;
+    int progressInterval;
+    const std::atomic<bool>* cancelFlag;
+    bool cancelled;
+
     // --- SERVER MECHANISM ---
     Task* serverTaskDefinition; // The "Fake" periodic task (Task ID 999)
     IServer* serverAlgo;        // The Strategy (Poller or Deferrable logic)
@@ -36,6 +109,12 @@ private:
     int gcd(int a, int b);
     int lcm(int a, int b);
     int calculateHyperperiod();
+    void releaseArrivals(int t, int& jobCounter, Task& pending, bool& hasPending);
+    void retireArrivals(int t);
+    void begin();
+    int releaseDelay(const Task& task, long long k) const;
+    int suspensionAfter(const Job& job) const;
+    bool step(int t); // One tick; false when it ends in a deadline miss
 
 public:
     Scheduler(const std::vector<Task>& pTasks, const std::vector<Task>& aTasks, 
@@ -44,7 +123,78 @@ public:
     ~Scheduler();
 
     void run();
+
+    // Stepwise run for a simulation that couples several schedulers (see
+    // experiments/DistributedSimulator.h): simulates ticks up to `until`
+    // (exclusive) and returns false once a deadline has been missed. No
+    // cancellation or progress reporting; hyperperiod is not a limit here.
+    bool advance(int until);
+
+    // Tasks of type Sporadic among the periodic tasks are not released on
+    // their period but only through releaseJob(): a job of task `taskId`
+    // arriving at tick t (not before the ticks already simulated), with an
+    // absolute deadline set by the caller. Returns the job id, -1 if there
+    // is no such task.
+    int releaseJob(int taskId, int t, int absoluteDeadline);
+
+    // Lower bound on the next completion of a released or pending job
+    // (remaining work with no preemption), INT_MAX if there is none
+    int earliestCompletion() const;
+
+    // Called when a job of a periodic or sporadic task completes (not for
+    // server or aperiodic jobs), at the end of its last tick
+    void setCompletionCallback(std::function<void(const Job&)> cb) { completionCallback = cb; }
     void exportToFile(const std::string& filename);
+    void exportColumnar(const std::string& directory);
+    void exportPyramid(const std::string& filename);
+
+    // Time-triggered table of the simulated schedule: NAME.bin plus a
+    // generated NAME.h (see DispatchTable.h / TableDispatcher.h). Periodic
+    // jobs and server executions get slots; background work is left to the
+    // idle time. Needs a complete run without misses over whole hyperperiods
+    // that ends with no periodic job left unfinished.
+    bool exportDispatchTable(const std::string& name);
+
+    // Replace the aperiodicTasks list with a stream (trace replay,
+    // generators). The run is extended to cover its last release, up to
+    // TRACE_LIMIT ticks. The stream must outlive run().
+    void setArrivalStream(ArrivalStream* stream);
+
+    void setVerbose(bool v) { verbose = v; }
+
+    // Release jitter pattern (default FirstDelayed); the seed drives Random
+    void setJitter(JitterMode mode, uint64_t seed = 1) { jitterMode = mode; jitterSeed = seed; }
+
+    // Off: history and budgetTrace are dropped tick by tick, so memory
+    // stays flat over millions of arrivals (nothing to export afterwards)
+    void setRecordHistory(bool record) { recordHistory = record; }
+
+    // Response time (ticks) of every aperiodic job that completed, and the
+    // number still waiting when the run ended
+    const std::vector<int>& aperiodicResponseTimes() const { return aperiodicResponses; }
+    size_t aperiodicBacklog() const { return streamedTasks.size(); }
+    // How long each of those has waited by the end of the run (ticks): a
+    // lower bound on its response time
+    std::vector<int> aperiodicBacklogAges() const {
+        std::vector<int> ages;
+        for (const auto& task : streamedTasks) ages.push_back(ticksSimulated - task.releaseTime);
+        return ages;
+    }
+    bool hasDeadlineMiss() const { return deadlineMissed; }
+    int simulatedTicks() const { return ticksSimulated; }
+
+    // Callback every `interval` ticks and once at the end of the run
+    void setProgressCallback(std::function<void(const ProgressInfo&)> cb, int interval) {
+        progressCallback = cb;
+        progressInterval = interval > 0 ? interval : 1;
+    }
+    // run() stops at the next tick boundary once *flag becomes true
+    void setCancelFlag(const std::atomic<bool>* flag) { cancelFlag = flag; }
+    bool wasCancelled() const { return cancelled; }
+
+    // Description column of output.txt for an event ("Periodic", "Server(Poller)", ...)
+    std::string describe(const TimelineEvent& event) const;
 
     std::vector<TimelineEvent> history;
+    std::vector<int> budgetTrace; // Server budget left at the end of each tick (server runs only)
 };
\ No newline at end of file
@@ -0,0 +1,65 @@
+#pragma once
+#include <cstdint>
+
+// Replays a dispatch table (see DispatchTable.h) without any scheduler:
+// works on the arrays of a header generated by DispatchTable::writeHeader
+// or on the vectors of a DispatchTable, and needs nothing but <cstdint>
+// so it can be copied next to the generated header on a target.
+//
+//     #include "cyclic_table.h"
+//     TableDispatcher<rt_cyclic_table::Slot, rt_cyclic_table::Block, rt_cyclic_table::Step>
+//         dispatcher(rt_cyclic_table::SLOTS, rt_cyclic_table::BLOCKS, rt_cyclic_table::STEPS,
+//                    rt_cyclic_table::STEP_COUNT, rt_cyclic_table::CYCLE_LENGTH,
+//                    rt_cyclic_table::FRAME_SIZE);
+//     // every tick: int32_t task = dispatcher.taskAt(now);
+//
+// Frame tables find the step with one division. Tables with steps of
+// varying length keep a cursor, which is O(1) per call as long as time
+// moves forward (a jump back rescans from the start of the cycle).
+template <typename Slot, typename Block, typename Step>
+class TableDispatcher {
+public:
+    TableDispatcher(const Slot* slots, const Block* blocks, const Step* steps, uint32_t stepCount,
+                    uint32_t cycleLength, uint32_t frameSize)
+        : slots(slots), blocks(blocks), steps(steps), stepCount(stepCount),
+          cycleLength(cycleLength), frameSize(frameSize), step(0), slot(0), last(0) {}
+
+    // Task to run during tick t, -1 = idle
+    int32_t taskAt(uint64_t t) {
+        if (stepCount == 0 || cycleLength == 0) return -1;
+        uint32_t local = (uint32_t)(t % cycleLength);
+
+        uint32_t current = step;
+        if (frameSize > 0) {
+            current = local / frameSize;
+        } else {
+            if (local < steps[current].start) current = 0;
+            while (current + 1 < stepCount && steps[current + 1].start <= local) current++;
+        }
+        if (current != step || local < last) slot = 0;
+        step = current;
+        last = local;
+        if (local < steps[step].start) return -1;
+
+        const Block& block = blocks[steps[step].block];
+        uint32_t offset = local - steps[step].start;
+        while (slot < block.slotCount) {
+            const Slot& s = slots[block.firstSlot + slot];
+            if (offset < s.offset) return -1;
+            if (offset < s.offset + s.duration) return s.taskId;
+            slot++;
+        }
+        return -1;
+    }
+
+private:
+    const Slot* slots;
+    const Block* blocks;
+    const Step* steps;
+    uint32_t stepCount;
+    uint32_t cycleLength;
+    uint32_t frameSize;
+    uint32_t step; // Cursor: current step, first slot not yet passed, last tick seen
+    uint32_t slot;
+    uint32_t last;
+};
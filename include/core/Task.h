@@ -1,6 +1,7 @@
 #pragma once
 #include <string>
 #include <iostream>
+#include <initializer_list>
 
 // Enum to distinguish between Periodic, Aperiodic, Sporadic, and Servers
 enum class TaskType {
@@ -18,14 +19,44 @@ struct Task {
     int releaseTime;        // r_i
     int computationTime;    // e_i (WCET)
     int period;             // p_i (or min inter-arrival time)
-    int relativeDeadline;   // d_i
+    int relativeDeadline;   // d_i (may exceed p_i: several jobs can be pending)
+    int jitter;             // J_i: job k arrives within [r + k p, r + k p + J]
 
-    // Constructor
-    Task(int id, TaskType type, int r, int c, int p, int d)
+    // Self-suspension: execution and suspension segments in turn (odd count,
+    // ticks), e.g. {20, 30, 10} computes 20, waits 30 off the processor,
+    // computes 10. The last execution segment runs whatever is left of
+    // computationTime. segmentCount 0 = one segment, no suspension.
+    static constexpr int MAX_SEGMENTS = 9;
+    int segmentCount;
+    int segments[MAX_SEGMENTS];
+
+    // Constructor (constexpr so task tables can be checked at compile time,
+    // see analysis/StaticAnalysis.h)
+    constexpr Task(int id, TaskType type, int r, int c, int p, int d, int j = 0)
         : id(id), type(type), releaseTime(r), computationTime(c), 
-          period(p), relativeDeadline(d) {}
+          period(p), relativeDeadline(d), jitter(j), segmentCount(0), segments{} {}
 
     // Default constructor
-    Task() : id(-1), type(TaskType::Periodic), releaseTime(0), 
-             computationTime(0), period(0), relativeDeadline(0) {}
+    constexpr Task() : id(-1), type(TaskType::Periodic), releaseTime(0), 
+             computationTime(0), period(0), relativeDeadline(0), jitter(0), segmentCount(0), segments{} {}
+
+    // Copy with the given segments (extra ones past MAX_SEGMENTS are dropped)
+    constexpr Task withSegments(std::initializer_list<int> list) const {
+        Task t = *this;
+        t.segmentCount = 0;
+        for (int s : list) {
+            if (t.segmentCount == MAX_SEGMENTS) break;
+            t.segments[t.segmentCount++] = s;
+        }
+        return t;
+    }
+
+    // Total suspension of one job, S_i (ticks)
+    constexpr int suspensionTime() const {
+        int total = 0;
+        for (int k = 1; k + 1 < segmentCount; k += 2) total += segments[k];
+        return total;
+    }
+
+    constexpr bool selfSuspending() const { return suspensionTime() > 0; }
 };
\ No newline at end of file
@@ -0,0 +1,78 @@
+#pragma once
+#include <vector>
+#include "Task.h"
+#include "../algorithms/AlgorithmFactory.h"
+
+// Distributed system model, in ticks: processors ("nodes") scheduled each
+// by their own algorithm, directed message links between them, and
+// transactions - chains of steps, each running on one node. A transaction
+// is released every period; each following step is released when the one
+// before it completes, plus the link latency when it moves to another
+// node. The end-to-end deadline counts from the transaction release.
+
+struct NodeSpec {
+    int id;
+    AlgorithmKind algorithm;
+};
+
+struct MessageLink {
+    int from;
+    int to;
+    int minLatency;
+    int maxLatency;
+};
+
+struct TransactionStep {
+    int node;
+    int computationTime;
+    int taskId;        // Task of the step on its node, unique in the system
+    int localDeadline; // Share of the end-to-end deadline (DM priority)
+};
+
+struct Transaction {
+    int id;
+    int period;
+    int deadline; // End to end
+    std::vector<TransactionStep> steps;
+};
+
+struct DistributedSystem {
+    std::vector<NodeSpec> nodes;
+    std::vector<MessageLink> links;
+    std::vector<Transaction> transactions;
+
+    // Link from -> to, nullptr if there is none
+    const MessageLink* link(int from, int to) const {
+        for (const auto& l : links) {
+            if (l.from == from && l.to == to) return &l;
+        }
+        return nullptr;
+    }
+
+    // Delay between a step completing on `from` and the next one being
+    // released on `to` (0 on the same node, -1 without a link)
+    int minLatency(int from, int to) const {
+        if (from == to) return 0;
+        const MessageLink* l = link(from, to);
+        return l ? l->minLatency : -1;
+    }
+    int maxLatency(int from, int to) const {
+        if (from == to) return 0;
+        const MessageLink* l = link(from, to);
+        return l ? l->maxLatency : -1;
+    }
+
+    // Tasks of the steps placed on `node`. They are typed Sporadic: the
+    // Scheduler leaves their release to the caller (Scheduler::releaseJob).
+    std::vector<Task> nodeTasks(int node) const {
+        std::vector<Task> tasks;
+        for (const auto& tr : transactions) {
+            for (const auto& s : tr.steps) {
+                if (s.node == node) {
+                    tasks.push_back(Task(s.taskId, TaskType::Sporadic, 0, s.computationTime, tr.period, s.localDeadline));
+                }
+            }
+        }
+        return tasks;
+    }
+};
@@ -0,0 +1,83 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <cstdint>
+#include "../core/ArrivalStream.h"
+#include "../utils/CounterRng.h"
+
+// Synthetic aperiodic load streamed straight into the Scheduler, for sizing
+// the Polling / Deferrable servers with millions of arrivals.
+//
+// Inter-arrival times are Poisson (exponential gaps) or a Markov-modulated
+// Poisson process: the process stays in state k for an exponential time with
+// mean stateDwell[k] while arriving at stateRates[k], then moves to the next
+// state (cyclically), which gives bursts on top of a base load. Execution
+// times are exponential, Pareto (heavy tail, shape > 1) or log-normal, all
+// parameterised by their mean. Times are in units and rounded to ticks.
+//
+// The sequence is a pure function of the config (seed included); the
+// constructor runs it once without emitting anything to learn the last
+// release, so the Scheduler can size the run up front.
+class ArrivalGenerator : public ArrivalStream {
+public:
+    enum class ArrivalModel { Poisson, MMPP };
+    enum class ExecModel { Exponential, Pareto, LogNormal };
+
+    // Default first task id, above SERVER_TASK_ID
+    static const int FIRST_ID = 1000;
+
+    struct Config {
+        ArrivalModel arrivals = ArrivalModel::Poisson;
+        double rate = 0.5;              // Poisson: arrivals per time unit
+        std::vector<double> stateRates; // MMPP: arrivals per time unit in each state
+        std::vector<double> stateDwell; // MMPP: mean time in each state (units)
+
+        ExecModel exec = ExecModel::Exponential;
+        double meanExec = 0.5;          // Units
+        double paretoShape = 2.5;       // alpha; the mean is finite for alpha > 1
+        double lognormalSigma = 1.0;    // Of the underlying normal
+
+        double relativeDeadline = 0.0;  // Units, 0 = none (soft aperiodic)
+        long long count = 100000;
+        uint64_t seed = 1;
+        int firstId = FIRST_ID;
+    };
+
+    // A configuration validate() rejects produces no arrivals
+    explicit ArrivalGenerator(const Config& config);
+
+    // False (with the reason) for a non-positive Poisson rate or an MMPP
+    // without a positive rate, with a non-positive dwell time or with
+    // mismatched rate / dwell lists
+    static bool validate(const Config& config, std::string& error);
+
+    bool next(Task& task) override;
+    int lastRelease() const override { return last; }
+
+    long long produced() const { return emitted; }
+
+    // Mean arrival rate (per unit) times mean execution time
+    double offeredLoad() const;
+
+    // Time-average arrival rate of the configured process (per unit)
+    double meanRate() const;
+
+    // E[S^2] of the execution time (units^2), draws clamped as in next()
+    double execSecondMoment() const;
+
+private:
+    Config config;
+    bool usable;
+    CounterRng rng;
+    long long emitted;
+    double time;      // Units
+    size_t state;
+    double stateEnd;  // Units
+    int last;
+
+    void restart();
+    double exponential(double mean);
+    double normal();
+    double execution();
+    double nextArrival();
+};
@@ -0,0 +1,52 @@
+#pragma once
+#include <vector>
+#include "../core/Task.h"
+
+// A small periodic task set (no aperiodics, no server)
+using TaskSet = std::vector<Task>;
+
+// Policies the batch engine can evaluate. Servers are not supported here,
+// use the full Scheduler for those.
+enum class BatchPolicy {
+    RateMonotonic,
+    DeadlineMonotonic,
+    EDF
+};
+
+// Lockstep simulator for schedulability-ratio experiments.
+// Packs one task set per lane (8 or 16 lanes) and steps all lanes together
+// with masked updates on structure-of-arrays state, so the inner loops
+// vectorize. Lanes that finish their hyperperiod or miss a deadline are
+// refilled from the remaining sets.
+//
+// Semantics match Scheduler::run() for constrained deadlines (d <= p), no
+// release jitter and no self-suspension: same release rule, same FIFO
+// tie-breaking, same "t + 1 > deadline" check. Task::jitter and
+// Task::segments are ignored (every job on time, in one piece).
+// Sets with more than MAX_TASKS tasks do not fit a lane and are reported
+// as unschedulable; run them through the Scheduler instead.
+class BatchSimulator {
+public:
+    static const int MAX_TASKS = 16;
+
+    BatchSimulator(BatchPolicy policy, int lanes = 16);
+
+    // result[i] == true if sets[i] met every deadline over its hyperperiod
+    std::vector<bool> run(const std::vector<TaskSet>& sets) const;
+
+    // Same as run(), with the sets split across worker threads
+    std::vector<bool> runParallel(const std::vector<TaskSet>& sets, int threads) const;
+
+    // True if the set fits one lane (at most MAX_TASKS tasks)
+    static bool fits(const TaskSet& set) { return set.size() <= (size_t)MAX_TASKS; }
+
+    // Hyperperiod with the same cap the Scheduler uses (SAFETY_LIMIT)
+    static int hyperperiodOf(const TaskSet& set);
+
+private:
+    BatchPolicy policy;
+    int lanes;
+
+    void runRange(const std::vector<TaskSet>& sets, size_t begin, size_t end,
+                  std::vector<char>& flags) const;
+};
@@ -0,0 +1,72 @@
+#pragma once
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include "../core/Transaction.h"
+#include "../core/Scheduler.h"
+
+// Simulates a DistributedSystem with one Scheduler per node, each with the
+// node's algorithm. A step job that completes sends a message to the node
+// of the next step, which releases that job after the link latency (drawn
+// per message between the link's min and max, so it is jitter). Step jobs
+// carry the end-to-end deadline of their transaction instance; a job still
+// running past it is a miss and ends the simulation like in Scheduler::run().
+//
+// Nodes run concurrently under conservative synchronization: no message
+// between nodes takes less than the lookahead (the shortest link latency),
+// so nothing sent in a window that ends at the earliest possible job
+// completion plus the lookahead can arrive inside it. All nodes simulate a
+// window in parallel, then messages are exchanged at a barrier. Delivery order is fixed (arrival, transaction,
+// instance, step) and latencies are drawn from a counter-based stream, so
+// the result does not depend on the thread count.
+class DistributedSimulator {
+public:
+    struct Config {
+        int threads = 1;
+        uint64_t seed = 1;
+        int horizon = 0;            // Ticks of transaction releases; 0 = hyperperiod (capped at SAFETY_LIMIT)
+        bool recordHistory = false; // Keep each node's timeline for node(i).exportToFile()
+    };
+
+    struct StepStats {
+        long long jobs = 0;
+        int minRelease = -1;  // Release after the transaction release, ticks
+        int maxRelease = -1;
+        int maxResponse = -1; // Completion after the transaction release
+    };
+
+    struct TransactionStats {
+        long long completed = 0;
+        int maxResponse = -1;       // End to end
+        double sumResponse = 0;
+        std::vector<StepStats> steps;
+    };
+
+    struct Result {
+        bool deadlineMiss = false;
+        int missTransaction = -1;   // Id of the transaction that missed
+        long long missInstance = -1;
+        int missTime = -1;
+        int ticks = 0;
+        int lookahead = 0;
+        int threads = 1;            // Workers used (at most one per node and per core)
+        long long windows = 0;
+        long long messages = 0;     // Between nodes
+        std::vector<TransactionStats> transactions;
+    };
+
+    DistributedSimulator(const DistributedSystem& system, const Config& config);
+    ~DistributedSimulator();
+
+    Result run();
+
+    size_t nodeCount() const { return nodes.size(); }
+    Scheduler& node(size_t i);
+
+private:
+    struct NodeState;
+
+    const DistributedSystem& system;
+    Config config;
+    std::vector<std::unique_ptr<NodeState>> nodes;
+};
@@ -0,0 +1,73 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <set>
+#include <cstdint>
+#include "TaskSetGenerator.h"
+#include "SweepCheckpoint.h"
+#include "../algorithms/AlgorithmFactory.h"
+
+// Acceptance ratio vs. utilization for every (algorithm, server policy) pair.
+// One TSV row per utilization bucket is appended and flushed as soon as the
+// bucket is done, so an interrupted experiment resumes from the last row.
+// The first line records the configuration signature; a file written by a
+// different configuration is never resumed.
+//
+// Each task set is a sweep item with its own CounterRng stream derived from
+// (seed, item index), so results are reproducible for any thread count
+// (bit-identical for a given toolchain).
+// Finished items inside unfinished buckets are kept in "<out>.ckpt".
+// A bucket with sets the generator could not draw gets a
+// "# skip <U> <sets not drawn>" line instead of a row.
+class ExperimentDriver {
+public:
+    enum class Mode { Analysis, Simulation };
+
+    struct Config {
+        Mode mode = Mode::Analysis;
+        double minUtilization = 0.05;
+        double maxUtilization = 1.0;
+        double utilizationStep = 0.05;
+        int setsPerBucket = 1000;
+        int threads = 1;
+        uint64_t seed = 1;
+        std::string outputPath = "../../data/acceptance.tsv";
+        bool isolate = false;            // Evaluate sets in forked worker processes
+        double itemTimeoutSeconds = 10.0; // Per-set budget when isolated
+        double checkpointSeconds = 30.0;  // Minimum time between checkpoint saves
+        std::string columnarDir;          // Per-set results as .npy columns (empty = off)
+        TaskSetGenerator::Config generator;
+    };
+
+    explicit ExperimentDriver(const Config& config);
+
+    void run();
+
+private:
+    struct Column {
+        AlgorithmKind algorithm;
+        std::string serverPolicy; // "Background", "Poller", "Deferrable"
+        std::string name;         // e.g. "EDF/Poller"
+    };
+
+    Config config;
+    std::vector<Column> columns;
+
+    std::set<std::string> completedBuckets(bool& sameConfig) const;
+    uint64_t signature() const;
+    std::string configLine() const;
+    TaskSet generateItem(size_t item, double utilization) const;
+
+    // One result word per set: bit k = accepted under columns[k]; a set
+    // the generator gave up on is NOT_DRAWN (no column bit)
+    static const uint32_t NOT_DRAWN = 1u << 31;
+    std::vector<uint32_t> evaluateSets(const std::vector<TaskSet>& sets) const;
+    std::vector<uint32_t> evaluateIsolated(const std::vector<TaskSet>& sets) const;
+    void acceptColumn(const std::vector<TaskSet>& sets, size_t k, std::vector<uint32_t>& bits) const;
+    bool evaluateSet(const TaskSet& set, const Column& column) const;
+    bool simulate(const TaskSet& set, const Column& column) const;
+    void writeWeightedSchedulability() const;
+    void writeColumnar(const SweepCheckpoint& checkpoint, int buckets) const;
+
+    static std::string bucketLabel(double utilization);
+};
@@ -0,0 +1,68 @@
+#pragma once
+#include <vector>
+#include <string>
+#include "../core/Task.h"
+
+// Global policies for identical processors
+enum class GlobalPolicy {
+    EDF,   // Global EDF, M earliest deadlines every tick
+    PD2,   // Pfair PD^2, one-tick quanta
+    LLREF  // Largest local remaining execution first, in DP-Fair slices
+};
+
+// Global scheduling of periodic tasks on M identical processors, with the
+// cost of each policy counted: preemptions (a job stopped before it is
+// done), migrations (a job resumed on another processor) and context
+// switches (a processor starting a different job).
+//
+// Global EDF and PD^2 run in ticks. PD^2 splits each job into one-tick
+// subtasks with windows from the weight C/D (subtask i of a job released
+// at r: [r + floor((i-1) D/C), r + ceil(i D/C))) and runs the M eligible
+// subtasks with the earliest window ends, ties by successor bit, then by
+// group deadline. That keeps every job within one tick of its fluid
+// allocation (the lag) and is optimal while sum C/D <= M.
+//
+// LLREF runs in continuous time. Every release and deadline starts a slice
+// in which each task gets exactly its fluid share C/D of the slice (the
+// DP-Fair rule); inside a slice the M tasks with the largest local
+// remaining execution run, re-chosen whenever one finishes its share or
+// another would run out of local laxity. Also optimal while sum C/D <= M.
+//
+// Processors keep the job they were running when it is chosen again, and a
+// job goes back to its last processor when that one is free. Deadlines past
+// the period are cut to the period (one job per task at a time); release
+// offsets are honoured; jitter and self-suspension are ignored.
+class MultiprocessorSimulator {
+public:
+    struct Result {
+        bool deadlineMiss = false;
+        int missTask = -1;
+        double missTime = -1;         // Ticks
+        double ticks = 0;             // Simulated
+        long long jobs = 0;           // Completed
+        long long preemptions = 0;
+        long long migrations = 0;
+        long long contextSwitches = 0;
+        double maxLag = 0;            // Largest |C/D (t - r) - done| of a job in its window, ticks
+    };
+
+    // Tasks without a period are left out
+    MultiprocessorSimulator(const std::vector<Task>& tasks, int processors);
+
+    // Until the first miss or `horizon` ticks (0 = hyperperiod, capped at SAFETY_LIMIT)
+    Result run(GlobalPolicy policy, int horizon = 0) const;
+
+    // sum C / min(D, T): the policies other than EDF are optimal up to M
+    double density() const;
+
+    static const char* name(GlobalPolicy policy);
+    static bool parsePolicy(const std::string& text, GlobalPolicy& policy);
+
+private:
+    std::vector<Task> tasks;
+    int processors;
+
+    Result runQuantum(GlobalPolicy policy, int horizon) const;
+    Result runFluid(int horizon) const;
+    int deadlineOf(const Task& task) const;
+};
@@ -0,0 +1,42 @@
+#pragma once
+#include <vector>
+#include <functional>
+#include <cstdint>
+
+// Runs sweep items in forked worker processes so that a crash, an abort or
+// a runaway item only costs that item, never the sweep.
+//
+// Workers pull item indices from a counter in shared memory and write one
+// fixed-size Record per item into a shared results array. The parent
+// restarts workers that die and kills workers whose current item exceeds
+// the time budget. On platforms without fork() items run in-process.
+class ProcessSweepExecutor {
+public:
+    enum Status : int32_t {
+        Pending = 0,
+        Done = 1,
+        Crashed = 2,
+        TimedOut = 3
+    };
+
+    struct Record {
+        int32_t status;   // Status
+        uint32_t bits;    // Item result (e.g. one accepted bit per column)
+    };
+
+    // Work for one item; the return value is stored in Record::bits
+    using WorkFn = std::function<uint32_t(size_t item)>;
+
+    ProcessSweepExecutor(int workers, double itemBudgetSeconds);
+
+    std::vector<Record> run(size_t itemCount, const WorkFn& work);
+
+    int restarts() const { return restartCount; }
+
+private:
+    int workers;
+    double itemBudgetSeconds;
+    int restartCount;
+
+    std::vector<Record> runPass(const std::vector<size_t>& items, const WorkFn& work);
+};
@@ -0,0 +1,39 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// Per-item progress of a long sweep, saved periodically so an interrupted
+// run resumes without redoing finished items.
+//
+// File layout (little-endian, native): magic, signature, item count, then
+// one {done:uint8, bits:uint32} pair per item. A checkpoint whose signature
+// (hash of the sweep configuration) or size doesn't match is ignored.
+// Saves go to "<path>.tmp" first and are renamed over the old file, so a
+// crash mid-save never corrupts the previous checkpoint.
+class SweepCheckpoint {
+public:
+    SweepCheckpoint(const std::string& path, uint64_t signature, size_t itemCount);
+
+    // Returns true if a matching checkpoint was loaded
+    bool load();
+    void save();
+
+    // Saves only if at least `intervalSeconds` passed since the last save
+    void saveIfDue(double intervalSeconds);
+
+    void remove();
+
+    bool isDone(size_t item) const { return done[item] != 0; }
+    uint32_t bits(size_t item) const { return results[item]; }
+    void markDone(size_t item, uint32_t bits);
+
+    size_t completedCount() const;
+
+private:
+    std::string path;
+    uint64_t signature;
+    std::vector<uint8_t> done;
+    std::vector<uint32_t> results;
+    double lastSave;
+};
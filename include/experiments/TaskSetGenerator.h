@@ -0,0 +1,31 @@
+#pragma once
+#include <vector>
+#include "BatchSimulator.h"
+#include "../utils/CounterRng.h"
+
+// Random periodic task sets for acceptance-ratio experiments (UUniFast;
+// UUniFast-discard above a utilization of 1, for multiprocessor sets).
+// Periods come from a menu of divisors of 2000 ticks so the hyperperiod
+// stays far below SAFETY_LIMIT and simulations cover it completely.
+class TaskSetGenerator {
+public:
+    struct Config {
+        int taskCount = 5;
+        double minDeadlineRatio = 1.0; // d = p * U[minDeadlineRatio, 1]; 1.0 = implicit
+        double maxTaskUtilization = 1.0; // Sets with a larger share are drawn again
+        std::vector<int> periods = {20, 25, 40, 50, 80, 100, 125, 200, 250, 400, 500, 1000};
+    };
+
+    // Draws UUniFast-discard makes before giving up on a set
+    static const int MAX_DRAWS = 1000;
+
+    explicit TaskSetGenerator(const Config& config) : config(config) {}
+
+    // Task set whose (pre-rounding) utilization sums to the target. Empty
+    // when the target is not below taskCount * maxTaskUtilization or no
+    // draw fits under the cap within MAX_DRAWS.
+    TaskSet generate(double utilization, CounterRng& rng) const;
+
+private:
+    Config config;
+};
@@ -0,0 +1,64 @@
+#pragma once
+#include <cstdint>
+
+// Reproducible checks of the fast analyses against a reference, run as
+// --experiment modes. Each draws its random cases from CounterRng streams
+// keyed by (seed, case index), prints one tab-separated result line per
+// configuration and returns the number of disagreements.
+class ValidationExperiments {
+public:
+    struct Config {
+        uint64_t seed = 1;
+        int count = 0;     // Random cases (operations, systems, ...); 0 = check default
+        int taskCount = 0; // Task set size where it applies; 0 = check default
+        int threads = 1;
+    };
+
+    // IncrementalRTA against a full re-analysis after every random add /
+    // remove / WCET update (admits() checked before every add), under RM
+    // and DM, with server ties and deadlines past the period. Then the
+    // time of one check + add on a large set against re-analysing it.
+    //   INCREMENTAL <RM|DM> <operations> <mismatches>
+    //   BENCH <tasks> <check+add us> <full re-analysis us>
+    static int incrementalRTA(const Config& config);
+
+    // QueueingEstimator against simulation: random RM periodic sets at
+    // Up 0.2 and 0.4, Poisson arrivals sized for rho 0.2 / 0.4 / 0.6 with
+    // exponential and Pareto execution times, under every server policy
+    // (20000 arrivals each). The estimator is for ranking, so a
+    // configuration disagrees when it orders two policies the other way
+    // round from the simulation while their simulated means are more than
+    // QUEUEING_RANK_GAP (relative) apart. Times in units:
+    //   QUEUEING <policy> <exp|pareto> <system> <Up> <rho> <est mean> <sim mean> <est p99> <sim p99>
+    //   QUEUEING_ERROR <policy> <cases> <median mean err> <max mean err> <median p99 err> <max p99 err>
+    //   QUEUEING_RANK <policy> <policy> <configuration> <simulated gap>   (each disagreement)
+    static int queueingEstimator(const Config& config);
+    static constexpr double QUEUEING_RANK_GAP = 0.2;
+
+    // ProbabilisticRTA against a Monte-Carlo run of the same model (the
+    // first job at the synchronous critical instant, execution times drawn
+    // per job, 200000 samples per task) on random RM sets with three-point
+    // profiles. A task disagrees when the two response-time CDFs are
+    // further apart than the DKW bound for PRTA_FALSE_ALARM. Then the FFT
+    // convolution against the direct sum (disagrees past FFT_TOLERANCE,
+    // relative to the largest value).
+    //   PRTA_MC <set> <task> <miss analysis> <miss simulated> <CDF distance>
+    //   PRTA_BOUND <samples> <distance bound> <disagreements>
+    //   FFT <length> <relative error>
+    static int probabilisticRTA(const Config& config);
+    static constexpr double PRTA_FALSE_ALARM = 1e-6;
+    static constexpr double FFT_TOLERANCE = 1e-9;
+
+    // HolisticAnalysis against DistributedSimulator on random systems of two
+    // or three nodes (mixed RM / DM / EDF / LST, jittery links) over their
+    // hyperperiod. Disagreements: a simulated release offset, release jitter
+    // or response outside its analysed bound, a miss on a system the
+    // analysis calls schedulable, and results that differ between 1 and 4
+    // simulation workers (capped at the core count, so on a single core
+    // that comparison holds trivially).
+    //   HOLISTIC <system> <nodes> <transactions> <SCHEDULABLE|UNSCHEDULABLE> <OK|DEADLINE_MISS>
+    //            <bound violations> <SAME|DIFFERENT>
+    //   HOLISTIC_SUMMARY <systems> <schedulable> <missed> <bound violations>
+    //            <missed when schedulable> <differing with threads>
+    static int holisticAnalysis(const Config& config);
+};
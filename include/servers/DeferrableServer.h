@@ -3,7 +3,7 @@
 
 class DeferrableServer : public IServer {
 public:
-    bool run(Job* serverJob, std::vector<Job*>& aperiodicQueue, 
+    bool run(Job* serverJob, std::deque<Job*>& aperiodicQueue, 
              std::vector<TimelineEvent>& history, int currentTime) override;
 
     std::string getName() const override { return "Deferrable Server"; }
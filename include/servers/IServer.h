@@ -1,5 +1,6 @@
 #pragma once
 #include <vector>
+#include <deque>
 #include "../core/Job.h"
 #include "../core/Scheduler.h" // For TimelineEvent struct
 
@@ -9,7 +10,7 @@ public:
 
     // Called when the Scheduler decides to run the Server Task
     // Returns: true if it executed work, false if it yielded (did nothing)
-    virtual bool run(Job* serverJob, std::vector<Job*>& aperiodicQueue, 
+    virtual bool run(Job* serverJob, std::deque<Job*>& aperiodicQueue, 
                      std::vector<TimelineEvent>& history, int currentTime) = 0;
 
     // Returns the name for logging
@@ -0,0 +1,59 @@
+#pragma once
+#include <vector>
+#include <string>
+#include "../core/Task.h"
+#include "../analysis/AnalysisCache.h"
+#include "../analysis/IncrementalRTA.h"
+#include "../utils/JsonLine.h"
+
+// Live task set for online admission decisions. Under RM/DM the analysis is
+// an IncrementalRTA: a query or change only touches the priority levels at
+// and below the affected task. EDF/LST re-run the demand test through an
+// AnalysisCache. Queries between changes are answered from the last result.
+//
+// handle() implements the service protocol: one JSON object per line in,
+// one per line out. Times are in user units, as in input.txt.
+//   {"op":"check","wcet":1,"period":5,"deadline":5}  would the task fit? ("jitter" optional)
+//   {"op":"add","id":7,"wcet":1,"period":5}          admit and keep it if it fits
+//   {"op":"remove","id":7}
+//   {"op":"update","id":7,"wcet":1.5}               change a task's WCET
+//   {"op":"slack"}                                   response times and slack per task
+// Every reply has "ok" and "elapsed_us"; errors carry "error".
+class AdmissionController {
+public:
+    struct Decision {
+        bool admitted;
+        int taskId;
+        int responseTime;            // Candidate's, ticks (-1 = misses or not computed)
+        std::vector<int> violations; // Tasks that would miss (fixed priority only)
+    };
+
+    AdmissionController(AlgorithmKind kind, const std::string& serverPolicy);
+
+    void load(const std::vector<Task>& periodicTasks);
+
+    Decision check(const Task& candidate);
+    Decision add(const Task& candidate); // Commits only if admitted
+    bool remove(int taskId);
+    bool updateWCET(int taskId, int computationTime);
+
+    bool schedulable() const;
+    const std::vector<Task>& tasks() const { return taskSet; }
+    double utilization() const;
+
+    std::string handle(const std::string& request);
+
+private:
+    AlgorithmKind kind;
+    std::string serverPolicy;
+    bool fixedPriority;
+    std::vector<Task> taskSet;  // Periodic tasks, without the server
+    IncrementalRTA rta;         // RM / DM
+    AnalysisCache cache;        // EDF / LST
+    bool demandOk;
+    int nextId;
+
+    void reanalyse();
+    bool hasTask(int taskId) const;
+    void addSlack(JsonLine& reply) const;
+};
@@ -0,0 +1,24 @@
+#pragma once
+#include <string>
+#include <atomic>
+#include "AdmissionController.h"
+
+// Serves an AdmissionController on a Unix domain socket. Clients send one
+// JSON request per line and get one JSON reply per line; any number of
+// clients can stay connected. Requests are handled one at a time on the
+// calling thread, so the controller needs no locking.
+class AdmissionServer {
+public:
+    AdmissionServer(AdmissionController& controller, const std::string& socketPath);
+
+    // Blocks until *stop becomes true. Returns false if the socket could
+    // not be opened (or on platforms without Unix sockets).
+    bool run(const std::atomic<bool>& stop);
+
+    size_t requestCount() const { return requests; }
+
+private:
+    AdmissionController& controller;
+    std::string socketPath;
+    size_t requests;
+};
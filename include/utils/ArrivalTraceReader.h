@@ -0,0 +1,46 @@
+#pragma once
+#include <string>
+#include <fstream>
+#include "../core/ArrivalStream.h"
+
+// Aperiodic arrivals streamed from a trace file, one record per line:
+//     release wcet [deadline]
+// in time units like input.txt (an "A" prefix is accepted, fields may be
+// separated by spaces, tabs or commas, '#' starts a comment). The deadline
+// is relative to the release; a record without one gets `defaultDeadline`
+// (ticks, 0 = none, as for A lines). Times past what fits in int ticks
+// are malformed. Records should be sorted by release; one that goes back
+// in time is released at the current position of the stream and counted
+// in outOfOrder().
+// Ids are assigned from `firstId` upwards in file order.
+class ArrivalTraceReader : public ArrivalStream {
+public:
+    ArrivalTraceReader(const std::string& path, int firstId, int defaultDeadline = 0);
+
+    bool isOpen() const { return file.is_open(); }
+
+    bool next(Task& task) override;
+
+    // Latest release in the file, found by one pass over it when it is
+    // opened (the trace is not held in memory)
+    int lastRelease() const override { return last; }
+
+    long long recordCount() const { return records; }
+    long long outOfOrder() const { return reordered; }
+    long long skippedLines() const { return skipped; }
+
+private:
+    std::ifstream file;
+    std::string line;
+    int nextId;
+    int defaultDeadline;
+    int last;
+    int previous;
+    long long records;
+    long long reordered;
+    long long skipped;
+
+    // Record -> task; false for malformed (and blank/comment) lines
+    static bool parseRecord(const std::string& line, int defaultDeadline, Task& task);
+    static int findLastRelease(const std::string& path, int defaultDeadline);
+};
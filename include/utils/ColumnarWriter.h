@@ -0,0 +1,45 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cstdint>
+
+// Writes a table as one NumPy .npy file per column, plus "schema.tsv".
+// Each file is a fixed-width little-endian array behind a small header,
+// so np.load(path, mmap_mode='r') maps it without parsing, and pandas can
+// wrap the arrays directly. Rows are streamed; the row count in each header
+// is patched when the writer is closed.
+class ColumnarWriter {
+public:
+    enum class Type { UInt8, Int32, Int64, Float64 };
+
+    explicit ColumnarWriter(const std::string& directory);
+    ~ColumnarWriter();
+
+    // Returns the column index used by append()
+    int addColumn(const std::string& name, Type type);
+
+    void append(int column, double value);
+
+    // Extra "key<TAB>value" lines stored with the schema (e.g. code tables)
+    void addNote(const std::string& key, const std::string& value);
+
+    bool isOpen() const { return ok; }
+    void close();
+
+private:
+    struct Column {
+        std::string name;
+        Type type;
+        std::ofstream file;
+        uint64_t rows;
+    };
+
+    std::string directory;
+    std::vector<Column*> columns;
+    std::vector<std::pair<std::string, std::string>> notes;
+    bool ok;
+    bool closed;
+
+    static void writeHeader(std::ofstream& out, Type type, uint64_t rows);
+};
@@ -0,0 +1,38 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+// Minimal "--flag value" argument lookup for the non-interactive modes
+class CommandLine {
+public:
+    CommandLine(int argc, char* argv[]) {
+        for (int i = 1; i < argc; i++) args.push_back(argv[i]);
+    }
+
+    bool has(const std::string& flag) const {
+        for (const auto& a : args) if (a == flag) return true;
+        return false;
+    }
+
+    // Value following the flag, or fallback when missing
+    std::string get(const std::string& flag, const std::string& fallback = "") const {
+        for (size_t i = 0; i + 1 < args.size(); i++) {
+            if (args[i] == flag) return args[i + 1];
+        }
+        return fallback;
+    }
+
+    int getInt(const std::string& flag, int fallback) const {
+        std::string v = get(flag);
+        return v.empty() ? fallback : std::atoi(v.c_str());
+    }
+
+    double getDouble(const std::string& flag, double fallback) const {
+        std::string v = get(flag);
+        return v.empty() ? fallback : std::atof(v.c_str());
+    }
+
+private:
+    std::vector<std::string> args;
+};
@@ -0,0 +1,50 @@
+#pragma once
+#include <cstdint>
+
+// Counter-based random stream. Draw n of stream (seed, index) is a pure
+// function of (seed, index, n): every sweep item gets its own stream, so
+// results don't depend on thread count or execution order, and any item
+// can be regenerated on its own when a sweep resumes.
+//
+// Conversions to double / ranges are done here (not with <random>
+// distributions, whose algorithms differ between standard libraries), so
+// the raw draws are the same everywhere. Generated task sets also go
+// through std::pow / std::log, whose last bits depend on the libm, so they
+// are only guaranteed identical for a given toolchain.
+class CounterRng {
+public:
+    using result_type = uint64_t;
+
+    CounterRng(uint64_t seed, uint64_t index)
+        : key(mix(mix(seed) ^ (index * 0xD1B54A32D192ED03ULL + 0x8CB92BA72F3D8DD7ULL))), counter(0) {}
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return ~0ULL; }
+
+    result_type operator()() {
+        counter++;
+        return mix(key + counter * 0x9E3779B97F4A7C15ULL);
+    }
+
+    // Uniform in [0, 1)
+    double uniform() {
+        return (double)((*this)() >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+    // Uniform integer in [0, n)
+    uint64_t below(uint64_t n) {
+        uint64_t v = (uint64_t)(uniform() * (double)n);
+        return v < n ? v : n - 1;
+    }
+
+private:
+    uint64_t key;
+    uint64_t counter;
+
+    // SplitMix64 finalizer
+    static uint64_t mix(uint64_t z) {
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+};
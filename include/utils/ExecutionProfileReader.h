@@ -0,0 +1,28 @@
+#pragma once
+#include <string>
+#include <map>
+#include <vector>
+
+// Execution-time distributions per task for ProbabilisticRTA, one point
+// per line in time units like input.txt:
+//     <task id> <execution time> <probability>
+//     <task id> miss <target>          (acceptable deadline-miss probability)
+// Ids are the ones the Scheduler assigns (1.. in input file order).
+// Fields may be separated by spaces, tabs or commas; '#' starts a comment.
+// Points of a task are merged by value (ticks, rounded up) and normalised
+// to sum 1. Tasks without points run their computationTime every time.
+class ExecutionProfileReader {
+public:
+    struct Profile {
+        std::vector<std::pair<int, double>> points; // (ticks, probability), sorted by ticks
+        double missTarget = -1;                     // -1 = none given
+    };
+
+    struct Result {
+        bool opened = false;
+        std::map<int, Profile> profiles;
+        long long skippedLines = 0;
+    };
+
+    static Result read(const std::string& path);
+};
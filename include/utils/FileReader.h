@@ -12,4 +12,19 @@ public:
     };
 
     static ParseResult readInputFile(const std::string& filename);
+
+    // One input line -> task (id left at -1). Returns false for blank,
+    // comment and unknown lines. A P/D line may end with "jitter J", the
+    // release jitter in units, and "segments E S E ...", the execution and
+    // suspension segments of a self-suspending task (the execution segments
+    // must add up to the exec field; malformed segments reject the line with a
+    // warning on stderr). `policy` gets "Poller"/"Deferrable" when the line
+    // carries a server tag, empty otherwise.
+    static bool parseLine(const std::string& line, Task& task, std::string& policy);
+
+    // Rewrites the execution time of a P/D line in place (units), leaving
+    // the other fields as written except the execution segments, which are
+    // rescaled to add up to it. False for any other line, or if a segment
+    // would shrink to nothing.
+    static bool setComputationTime(std::string& line, double units);
 };
\ No newline at end of file
@@ -0,0 +1,31 @@
+#pragma once
+#include <string>
+#include <cstdint>
+
+// Waits for a file to be modified. Uses inotify on Linux, watching the
+// parent directory so editors that save via rename are seen too; elsewhere
+// (or if inotify is unavailable) it polls the modification time.
+class FileWatcher {
+public:
+    explicit FileWatcher(const std::string& path);
+    ~FileWatcher();
+
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    // True if the file changed within timeoutMs. Bursts of events (editors
+    // often write several times per save) are collapsed into one change.
+    bool waitForChange(int timeoutMs);
+
+    bool usesInotify() const { return fd >= 0; }
+
+private:
+    std::string directory;
+    std::string name;
+    int fd;
+    int wd;
+    int64_t lastStamp;
+
+    int64_t stamp() const;
+    bool readEvents(int timeoutMs);
+};
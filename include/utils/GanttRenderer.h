@@ -0,0 +1,76 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <map>
+#include <cstdint>
+
+// Streaming Gantt chart renderer (SVG and PNG) for traces of any length.
+// Input is consumed as it arrives: every lane keeps one counter per screen
+// column, and when a tick lands past the last column the column width is
+// doubled by folding neighbours together. Memory and output size therefore
+// depend on the image width, not on the trace; sub-pixel slices only add to
+// their column's coverage, and runs of equal columns become a single rect.
+class GanttRenderer {
+public:
+    struct Options {
+        int width = 1600;
+        int laneHeight = 26;
+        int budgetHeight = 90;  // Server budget panel, only drawn if budget was added
+        int ticksPerUnit = 10;  // Axis labels in user time units
+        std::string title = "Gantt Chart - Task Execution Timeline";
+    };
+
+    explicit GanttRenderer(const Options& options);
+
+    // Execution of [start, end) ticks. The description picks the lane color
+    // and label ("Periodic", "Server(Poller)", ...); server descriptions win.
+    void addSlice(int taskId, const std::string& description, int start, int end);
+    void addArrival(int taskId, int tick);
+    void addDeadline(int taskId, int tick);
+    void addMiss(int taskId, int tick);
+    void addBudget(int tick, int budget, int capacity);
+
+    // Extends the time axis without adding work (e.g. trailing idle time)
+    void extendTo(int tick);
+    int horizon() const { return end; }
+
+    bool writeSvg(const std::string& path) const;
+    bool writePng(const std::string& path) const;
+
+private:
+    struct Lane {
+        int taskId;
+        std::string description;
+        std::vector<uint32_t> busy;    // Ticks executed per column
+        std::vector<uint8_t> arrivals; // Marker flags per column
+        std::vector<uint8_t> deadlines;
+        std::vector<uint8_t> misses;
+    };
+
+    // Drawing primitives shared by both back ends
+    struct Shape {
+        enum Kind { Rect, Line, DashedLine, Text, TextRight, TextCenter } kind;
+        int x0, y0, x1, y1; // Rect: x, y, width, height
+        uint32_t color;
+        float alpha;
+        std::string text;
+    };
+
+    Options options;
+    int columns;
+    int scale; // Ticks per column, a power of two
+    int end;   // One past the last tick seen
+
+    std::vector<Lane> lanes;
+    std::map<int, size_t> laneOf;
+    std::vector<int32_t> budgetMin; // -1 = no sample in the column
+    std::vector<int32_t> budgetMax;
+    int budgetCapacity;
+
+    Lane& lane(int taskId, const std::string& description);
+    void reserve(int tick);
+    void fold();
+
+    std::vector<Shape> layout(int& height) const;
+    static uint32_t colorOf(const std::string& description);
+};
@@ -0,0 +1,29 @@
+#pragma once
+#include <string>
+#include <unordered_map>
+#include "FileReader.h"
+
+// Keeps the parsed form of every input line between reloads (watch mode).
+// A reload still reads the file, but only lines whose text changed go
+// through FileReader::parseLine again; ids are re-assigned in file order
+// exactly as readInputFile does, so the result is identical.
+class InputCache {
+public:
+    // Same result as FileReader::readInputFile(filename)
+    FileReader::ParseResult load(const std::string& filename);
+
+    // Statistics of the last load()
+    size_t lineCount() const { return lines; }
+    size_t reparsedCount() const { return reparsed; }
+
+private:
+    struct Entry {
+        bool valid;
+        Task task;
+        std::string policy;
+    };
+
+    std::unordered_map<std::string, Entry> parsed; // Keyed by line text
+    size_t lines = 0;
+    size_t reparsed = 0;
+};
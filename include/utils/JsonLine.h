@@ -0,0 +1,92 @@
+#pragma once
+#include <string>
+#include <map>
+#include <sstream>
+#include <cctype>
+
+// One flat JSON object per line, enough for the admission service protocol.
+// parse() accepts string, number, true/false/null values (no nesting) and
+// returns them as text; the builder writes objects with pre-rendered values.
+class JsonLine {
+public:
+    static bool parse(const std::string& line, std::map<std::string, std::string>& fields) {
+        fields.clear();
+        size_t i = 0;
+        auto skip = [&]() { while (i < line.size() && std::isspace((unsigned char)line[i])) i++; };
+
+        skip();
+        if (i >= line.size() || line[i] != '{') return false;
+        i++;
+        skip();
+        if (i < line.size() && line[i] == '}') return true;
+
+        while (i < line.size()) {
+            std::string key, value;
+            skip();
+            if (!readString(line, i, key)) return false;
+            skip();
+            if (i >= line.size() || line[i] != ':') return false;
+            i++;
+            skip();
+            if (i < line.size() && line[i] == '"') {
+                if (!readString(line, i, value)) return false;
+            } else {
+                size_t start = i;
+                while (i < line.size() && line[i] != ',' && line[i] != '}' && !std::isspace((unsigned char)line[i])) i++;
+                value = line.substr(start, i - start);
+                if (value.empty() || value[0] == '{' || value[0] == '[') return false;
+            }
+            fields[key] = value;
+            skip();
+            if (i < line.size() && line[i] == ',') { i++; continue; }
+            if (i < line.size() && line[i] == '}') return true;
+            return false;
+        }
+        return false;
+    }
+
+    JsonLine& add(const std::string& key, const std::string& value) { return raw(key, quote(value)); }
+    JsonLine& add(const std::string& key, const char* value) { return raw(key, quote(value)); }
+    JsonLine& add(const std::string& key, bool value) { return raw(key, value ? "true" : "false"); }
+    JsonLine& add(const std::string& key, int value) { return raw(key, std::to_string(value)); }
+    JsonLine& add(const std::string& key, double value) {
+        std::ostringstream ss;
+        ss << value;
+        return raw(key, ss.str());
+    }
+
+    // Value already rendered as JSON (arrays, nested objects)
+    JsonLine& raw(const std::string& key, const std::string& json) {
+        body += (body.empty() ? "" : ",") + quote(key) + ":" + json;
+        return *this;
+    }
+
+    std::string str() const { return "{" + body + "}"; }
+
+    static std::string quote(const std::string& s) {
+        std::string out = "\"";
+        for (char c : s) {
+            if (c == '"' || c == '\\') out += '\\';
+            if (c == '\n') { out += "\\n"; continue; }
+            out += c;
+        }
+        return out + "\"";
+    }
+
+private:
+    std::string body;
+
+    static bool readString(const std::string& line, size_t& i, std::string& out) {
+        if (i >= line.size() || line[i] != '"') return false;
+        for (i++; i < line.size(); i++) {
+            if (line[i] == '"') { i++; return true; }
+            if (line[i] == '\\' && i + 1 < line.size()) {
+                i++;
+                out += line[i] == 'n' ? '\n' : line[i] == 't' ? '\t' : line[i];
+                continue;
+            }
+            out += line[i];
+        }
+        return false;
+    }
+};
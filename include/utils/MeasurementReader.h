@@ -0,0 +1,21 @@
+#pragma once
+#include <string>
+#include <functional>
+
+// Measured execution times, one sample per line:
+//     <task id> <execution time>
+//     <execution time>                 (sample of `defaultId`)
+// in time units like input.txt. Fields may be separated by spaces, tabs or
+// commas; '#' starts a comment. Samples are handed to `sink` as they are
+// read, so files of any size stream in constant memory.
+class MeasurementReader {
+public:
+    struct Counts {
+        bool opened = false;
+        long long samples = 0;
+        long long skippedLines = 0;
+    };
+
+    // defaultId < 0: single-value lines are skipped
+    static Counts read(const std::string& path, int defaultId, const std::function<void(int, double)>& sink);
+};
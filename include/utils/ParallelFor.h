@@ -0,0 +1,23 @@
+#pragma once
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <functional>
+
+// Runs body(i) for i in [0, count) on a pool of threads.
+// Items are handed out one at a time, so uneven work balances itself.
+inline void parallelFor(size_t count, int threads, const std::function<void(size_t)>& body) {
+    if (threads <= 1 || count <= 1) {
+        for (size_t i = 0; i < count; i++) body(i);
+        return;
+    }
+
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> workers;
+    for (int w = 0; w < threads; w++) {
+        workers.emplace_back([&]() {
+            for (size_t i = next++; i < count; i = next++) body(i);
+        });
+    }
+    for (auto& w : workers) w.join();
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// Minimal RGB raster with a PNG encoder and no external dependencies.
+// The image data goes out as zlib "stored" blocks (no compression), which
+// keeps the encoder a few dozen lines; chart images are small enough that
+// the size does not matter.
+class PngWriter {
+public:
+    PngWriter(int width, int height, uint32_t background);
+
+    int width() const { return w; }
+    int height() const { return h; }
+
+    // Colors are 0xRRGGBB, alpha in [0, 1]
+    void fillRect(int x, int y, int width, int height, uint32_t color, float alpha = 1.0f);
+    void line(int x0, int y0, int x1, int y1, uint32_t color, bool dashed = false);
+
+    // Built-in 3x5 pixel font, `scale` pixels per font pixel. Lowercase is
+    // drawn as uppercase; characters without a glyph are skipped.
+    void text(int x, int y, const std::string& s, uint32_t color, int scale = 2);
+    static int textWidth(const std::string& s, int scale = 2) { return (int)s.size() * 4 * scale; }
+
+    bool write(const std::string& path) const;
+
+private:
+    int w;
+    int h;
+    std::vector<uint8_t> pixels; // RGB, row-major
+
+    void blend(int x, int y, uint32_t color, float alpha);
+};
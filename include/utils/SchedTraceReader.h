@@ -0,0 +1,43 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <functional>
+#include <cstdint>
+
+// Streams the text output of the Linux function tracer (tracefs "trace"
+// file or `trace-cmd report`) and hands out its sched_switch and
+// sched_wakeup / sched_wakeup_new records. Both payload styles are read:
+//     ... 5678.123456: sched_switch: prev_comm=a prev_pid=1 prev_prio=120 prev_state=S ==> next_comm=b next_pid=2 next_prio=120
+//     ... 5678.123456: sched_switch: a:1 [120] S ==> b:2 [120]
+//     ... 5678.123400: sched_wakeup: comm=b pid=2 prio=120 target_cpu=001
+//     ... 5678.123400: sched_wakeup: b:2 [120] CPU:001
+// The file is read in large blocks and parsed in place: lines and fields
+// are views into the block, nothing is copied or allocated per record.
+// Other events and unparsable lines are counted and skipped.
+class SchedTraceReader {
+public:
+    struct Event {
+        enum class Kind { Switch, Wakeup };
+        Kind kind;
+        uint64_t timestamp;    // ns
+        int cpu;
+        int prevPid;           // Switch only
+        bool prevRunnable;     // Switch only: prev_state R / R+ (preempted, not blocked)
+        int pid;               // Switch: next pid; Wakeup: woken pid
+        std::string_view comm; // Of `pid`; valid during the callback only
+    };
+
+    struct Counts {
+        bool opened = false;
+        long long lines = 0;
+        long long events = 0;
+        long long skipped = 0; // sched_switch / sched_wakeup lines that did not parse
+        long long bytes = 0;
+    };
+
+    static Counts read(const std::string& path, const std::function<void(const Event&)>& sink);
+
+    // One line (without the newline); false if it is not a parsable
+    // sched_switch / sched_wakeup record
+    static bool parseLine(std::string_view line, Event& event, bool& relevant);
+};
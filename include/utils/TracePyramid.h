@@ -0,0 +1,53 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "../core/Scheduler.h"
+
+// Multi-resolution summary of a finished run for zoomable charts.
+// Level k aggregates 2^k ticks per bucket: busy fraction per lane, deadline
+// misses, and server budget min/max. A viewer picks the level whose bucket
+// count over the visible range fits the screen width and reads only that
+// slice, so drawing cost depends on pixels, not on trace length.
+//
+// Binary layout (little-endian):
+//   "RTLOD1\0\0", u32 levels, u32 lanes, u32 horizon ticks, u32 ticks per unit
+//   lanes  x { i32 task id, u16 name length, name bytes }
+//   levels x { u32 bucket ticks, u32 bucket count, u64 file offset }
+//   per level, per bucket: f32 busy[lanes], u32 misses, i32 budget min, i32 budget max
+// Budget fields are -1 when the run has no server.
+class TracePyramid {
+public:
+    struct Lane {
+        int taskId;
+        std::string name; // Same description as output.txt ("Periodic", "Server(Poller)", ...)
+    };
+
+    // One lane per task that executes; horizon = simulated ticks
+    TracePyramid(const std::vector<Lane>& lanes, int horizon);
+
+    void addBusyTick(int lane, int tick);
+    void addMiss(int tick);
+    void setBudget(int tick, int budget);
+
+    bool write(const std::string& path) const;
+
+    // Per-tick server budget from the finest level of a written summary.
+    // Returns false if the file is missing or has no budget data.
+    static bool readBudget(const std::string& path, std::vector<int32_t>& budget);
+
+private:
+    struct Level {
+        int bucketTicks;
+        std::vector<uint32_t> busy;   // [bucket * lanes + lane], ticks busy
+        std::vector<uint32_t> misses; // [bucket]
+        std::vector<int32_t> budgetMin;
+        std::vector<int32_t> budgetMax;
+    };
+
+    std::vector<Lane> lanes;
+    int horizon;
+    Level base;
+
+    std::vector<Level> buildLevels() const;
+};
@@ -0,0 +1,31 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "../core/Transaction.h"
+
+// Distributed system description, times in units like input.txt:
+//     N <node id> <RM|DM|EDF|LST>
+//     L <from node> <to node> <latency> [<max latency>]
+//     T <period> <end-to-end deadline> <node>:<exec> [<node>:<exec> ...]
+// Links are one-way; a latency range models message jitter. Transactions
+// are numbered 1.. in file order and their step tasks 1.. over the file.
+// Each step gets a local deadline, the end-to-end deadline minus the worst
+// link latencies split in proportion to execution time (DM priorities).
+// '#' starts a comment.
+class TransactionReader {
+public:
+    struct Result {
+        bool opened = false;
+        DistributedSystem system;
+        long long skippedLines = 0;
+        std::vector<std::string> errors; // Inconsistent model (unknown node, missing link, ...)
+    };
+
+    static Result read(const std::string& path);
+
+    // Local deadlines of every step, as read() assigns them
+    static void splitDeadlines(DistributedSystem& system);
+
+    // "RM", "DM", "EDF", "LST" or the menu number; false if neither
+    static bool parseAlgorithm(const std::string& text, AlgorithmKind& kind);
+};
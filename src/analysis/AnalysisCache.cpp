@@ -0,0 +1,75 @@
+#include "../../include/analysis/AnalysisCache.h"
+#include "../../include/analysis/SchedulabilityAnalysis.h"
+#include <algorithm>
+
+namespace {
+
+// Entries are tiny; this only stops unbounded growth over a long session
+const size_t MAX_ENTRIES = 1 << 16;
+
+std::string keyOf(std::vector<std::string> parts) {
+    std::sort(parts.begin(), parts.end());
+    std::string key;
+    for (const auto& p : parts) key += p + ";";
+    return key;
+}
+
+} // namespace
+
+AnalysisCache::Result AnalysisCache::analyse(const std::vector<Task>& periodicTasks, AlgorithmKind kind,
+                                             const std::string& serverPolicy) {
+    hits = 0;
+    computed = 0;
+    if (responseTimes.size() > MAX_ENTRIES) responseTimes.clear();
+    if (demandTests.size() > MAX_ENTRIES) demandTests.clear();
+
+    Result result{true, {}};
+    std::vector<Task> tasks = SchedulabilityAnalysis::withServer(periodicTasks, serverPolicy);
+
+    if (kind != AlgorithmKind::RateMonotonic && kind != AlgorithmKind::DeadlineMonotonic) {
+        std::vector<std::string> parts;
+        for (const auto& t : tasks) {
+            // Suspension counts as computation in the demand test
+            parts.push_back(std::to_string(t.computationTime + t.suspensionTime()) + "," +
+                            std::to_string(t.period) + "," + std::to_string(t.relativeDeadline) + "," +
+                            std::to_string(SchedulabilityAnalysis::releaseJitter(t)));
+        }
+        std::string key = keyOf(parts);
+        auto it = demandTests.find(key);
+        if (it != demandTests.end()) {
+            hits++;
+        } else {
+            computed++;
+            it = demandTests.emplace(key, SchedulabilityAnalysis::demandBoundTest(tasks)).first;
+        }
+        result.schedulable = it->second;
+        return result;
+    }
+
+    std::vector<Task> sorted = SchedulabilityAnalysis::priorityOrder(tasks, kind);
+    std::vector<std::string> higher;
+    for (size_t i = 0; i < sorted.size(); i++) {
+        const Task& t = sorted[i];
+        // Own period and jitter matter once later jobs of the busy window count
+        std::string key = std::to_string(t.computationTime) + "," + std::to_string(t.relativeDeadline) + "," +
+                          std::to_string(t.period) + "," + std::to_string(t.jitter) + "," +
+                          std::to_string(t.suspensionTime()) + "|" + keyOf(higher);
+
+        auto it = responseTimes.find(key);
+        if (it != responseTimes.end()) {
+            hits++;
+        } else {
+            computed++;
+            it = responseTimes.emplace(key, SchedulabilityAnalysis::responseTime(sorted, i, t.relativeDeadline)).first;
+        }
+
+        result.tasks.push_back({t.id, it->second, t.relativeDeadline});
+        if (it->second < 0) result.schedulable = false;
+        // A self-suspending task interferes by its response time (-1 if it
+        // misses, which is all the levels below need to know)
+        higher.push_back(std::to_string(t.computationTime) + "," + std::to_string(t.period) + "," +
+                         std::to_string(t.selfSuspending() && it->second < 0
+                                            ? -1 : SchedulabilityAnalysis::interferenceJitter(t, it->second)));
+    }
+    return result;
+}
@@ -0,0 +1,218 @@
+#include "../../include/analysis/CyclicExecutive.h"
+#include <algorithm>
+#include <numeric>
+
+namespace {
+
+// Dinic max-flow; paths here are only three edges long
+class FlowNetwork {
+public:
+    struct Edge {
+        int to;
+        long long cap;
+        int rev;
+    };
+
+    explicit FlowNetwork(int nodes) : graph(nodes), level(nodes), next(nodes) {}
+
+    // Returns the index of the edge in graph[from]
+    int addEdge(int from, int to, long long cap) {
+        graph[from].push_back({to, cap, (int)graph[to].size()});
+        graph[to].push_back({from, 0, (int)graph[from].size() - 1});
+        return (int)graph[from].size() - 1;
+    }
+
+    long long maxFlow(int source, int sink) {
+        long long total = 0;
+        while (buildLevels(source, sink)) {
+            std::fill(next.begin(), next.end(), 0);
+            while (long long pushed = augment(source, sink, -1)) total += pushed;
+        }
+        return total;
+    }
+
+    // Flow carried by edge `index` of node `from`
+    long long flow(int from, int index) const {
+        const Edge& e = graph[from][index];
+        return graph[e.to][e.rev].cap;
+    }
+
+private:
+    std::vector<std::vector<Edge>> graph;
+    std::vector<int> level;
+    std::vector<size_t> next;
+
+    bool buildLevels(int source, int sink) {
+        std::fill(level.begin(), level.end(), -1);
+        std::vector<int> queue{source};
+        level[source] = 0;
+        for (size_t head = 0; head < queue.size(); head++) {
+            int u = queue[head];
+            for (const Edge& e : graph[u]) {
+                if (e.cap > 0 && level[e.to] < 0) {
+                    level[e.to] = level[u] + 1;
+                    queue.push_back(e.to);
+                }
+            }
+        }
+        return level[sink] >= 0;
+    }
+
+    // limit < 0: unbounded (from the source)
+    long long augment(int u, int sink, long long limit) {
+        if (u == sink) return limit;
+        for (; next[u] < graph[u].size(); next[u]++) {
+            Edge& e = graph[u][next[u]];
+            if (e.cap <= 0 || level[e.to] != level[u] + 1) continue;
+            long long pushed = augment(e.to, sink, limit < 0 ? e.cap : std::min(limit, e.cap));
+            if (pushed > 0) {
+                e.cap -= pushed;
+                graph[e.to][e.rev].cap += pushed;
+                return pushed;
+            }
+        }
+        return 0;
+    }
+};
+
+struct CycleJob {
+    int taskId;
+    int release;   // Ticks into the cycle
+    int deadline;  // Absolute, clipped to the cycle end
+    int work;
+};
+
+// Bound on job->frame edges per trial, keeps tiny frames on big cycles tractable
+const long long MAX_EDGES = 4000000;
+
+} // namespace
+
+std::vector<int> CyclicExecutive::frameCandidates(const std::vector<Task>& tasks, int hyperperiod) {
+    int maxWork = 0;
+    for (const auto& t : tasks) maxWork = std::max(maxWork, t.computationTime);
+
+    std::vector<int> whole, split;
+    for (int f = hyperperiod; f >= 1; f--) {
+        if (hyperperiod % f != 0) continue;
+        bool fits = true;
+        for (const auto& t : tasks) {
+            if (2 * f - std::gcd(t.period, f) > t.relativeDeadline) { fits = false; break; }
+        }
+        if (fits) (f >= maxWork ? whole : split).push_back(f);
+    }
+    whole.insert(whole.end(), split.begin(), split.end());
+    return whole;
+}
+
+CyclicExecutive::Result CyclicExecutive::synthesize(const std::vector<Task>& periodicTasks) {
+    Result result;
+
+    std::vector<Task> tasks;
+    for (const auto& t : periodicTasks) {
+        if (t.period > 0 && t.computationTime > 0) tasks.push_back(t);
+    }
+    if (tasks.empty()) {
+        result.reason = "no periodic tasks";
+        return result;
+    }
+
+    long long h = 1;
+    long long demand = 0;
+    for (const auto& t : tasks) {
+        h = h / std::gcd(h, (long long)t.period) * t.period;
+        if (h > MAX_CYCLE) {
+            result.reason = "hyperperiod exceeds " + std::to_string(MAX_CYCLE) + " ticks";
+            return result;
+        }
+    }
+    result.hyperperiod = (int)h;
+
+    // Jobs of one cycle; phases are taken modulo the period so every cycle
+    // sees the same releases (in the very first one, slots of a task before
+    // its first release stay idle)
+    std::vector<CycleJob> jobs;
+    for (const auto& t : tasks) {
+        for (int release = t.releaseTime % t.period; release < h; release += t.period) {
+            int deadline = (int)std::min<long long>(h, (long long)release + t.relativeDeadline);
+            jobs.push_back({t.id, release, deadline, t.computationTime});
+            demand += t.computationTime;
+        }
+    }
+    result.jobs = (int)jobs.size();
+    if (demand > h) {
+        result.reason = "utilization above 1";
+        return result;
+    }
+
+    result.candidates = frameCandidates(tasks, result.hyperperiod);
+
+    for (int f : result.candidates) {
+        int frames = result.hyperperiod / f;
+
+        long long edges = 0;
+        for (const auto& j : jobs) edges += std::max(0, (j.deadline - j.release) / f);
+        if (edges > MAX_EDGES) continue;
+        result.framesTried++;
+
+        // Nodes: 0 source, 1 sink, jobs, then frames
+        const int source = 0, sink = 1, firstJob = 2, firstFrame = 2 + (int)jobs.size();
+        FlowNetwork net(firstFrame + frames);
+        std::vector<std::vector<std::pair<int, int>>> jobEdges(jobs.size()); // (frame, edge index)
+
+        for (size_t j = 0; j < jobs.size(); j++) {
+            net.addEdge(source, firstJob + (int)j, jobs[j].work);
+            int first = (jobs[j].release + f - 1) / f;
+            for (int k = first; (k + 1) * f <= jobs[j].deadline; k++) {
+                jobEdges[j].push_back({k, net.addEdge(firstJob + (int)j, firstFrame + k, f)});
+            }
+        }
+        for (int k = 0; k < frames; k++) net.addEdge(firstFrame + k, sink, f);
+
+        if (net.maxFlow(source, sink) < demand) continue;
+
+        // Slices per frame, earliest deadline first
+        struct Piece { int deadline; int taskId; int amount; };
+        std::vector<std::vector<Piece>> frameWork(frames);
+        result.splitJobs = 0;
+        for (size_t j = 0; j < jobs.size(); j++) {
+            int used = 0;
+            for (const auto& [k, index] : jobEdges[j]) {
+                long long amount = net.flow(firstJob + (int)j, index);
+                if (amount <= 0) continue;
+                frameWork[k].push_back({jobs[j].deadline, jobs[j].taskId, (int)amount});
+                used++;
+            }
+            if (used > 1) result.splitJobs++;
+        }
+
+        DispatchTable& table = result.table;
+        table.cycleLength = (uint32_t)result.hyperperiod;
+        table.frameSize = (uint32_t)f;
+        for (int k = 0; k < frames; k++) {
+            auto& work = frameWork[k];
+            std::stable_sort(work.begin(), work.end(), [](const Piece& a, const Piece& b) {
+                return a.deadline != b.deadline ? a.deadline < b.deadline : a.taskId < b.taskId;
+            });
+
+            std::vector<DispatchTable::Slot> slots;
+            uint32_t offset = 0;
+            for (const auto& p : work) {
+                if (!slots.empty() && slots.back().taskId == p.taskId) {
+                    slots.back().duration += p.amount;
+                } else {
+                    slots.push_back({offset, p.taskId, (uint32_t)p.amount});
+                }
+                offset += p.amount;
+            }
+            table.steps.push_back({(uint32_t)(k * f), table.addBlock((uint32_t)f, slots)});
+        }
+
+        result.feasible = true;
+        result.frameSize = f;
+        return result;
+    }
+
+    result.reason = result.framesTried == 0 ? "every frame size is too small for this cycle"
+                                            : "no frame size admits a feasible assignment";
+    return result;
+}
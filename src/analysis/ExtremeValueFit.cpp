@@ -0,0 +1,105 @@
+#include "../../include/analysis/ExtremeValueFit.h"
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+namespace {
+
+const double EULER_GAMMA = 0.5772156649015329;
+const double PI = 3.14159265358979323846;
+
+} // namespace
+
+ExtremeValueFit::ExtremeValueFit(int blockSize, size_t tailSize)
+    : blockSize(std::max(1, blockSize)), tailSize(std::max<size_t>(MIN_TAIL + 1, tailSize)), samples(0),
+      highest(-std::numeric_limits<double>::infinity()), blockMax(0), blockFill(0), blocks(0), maxMean(0),
+      maxM2(0) {}
+
+void ExtremeValueFit::add(double value) {
+    samples++;
+    highest = std::max(highest, value);
+
+    blockMax = blockFill == 0 ? value : std::max(blockMax, value);
+    if (++blockFill == blockSize) {
+        blocks++;
+        double delta = blockMax - maxMean;
+        maxMean += delta / blocks;
+        maxM2 += delta * (blockMax - maxMean);
+        blockFill = 0;
+    }
+
+    if (tail.size() < tailSize) tail.push(value);
+    else if (value > tail.top()) {
+        tail.pop();
+        tail.push(value);
+    }
+}
+
+ExtremeValueFit::Gumbel ExtremeValueFit::gumbel() const {
+    Gumbel g{false, 0, 0, blockSize};
+    if (blocks < MIN_BLOCKS) return g;
+    double sd = std::sqrt(maxM2 / (blocks - 1));
+    g.scale = sd * std::sqrt(6.0) / PI;
+    g.location = maxMean - EULER_GAMMA * g.scale;
+    g.valid = g.scale > 0;
+    return g;
+}
+
+double ExtremeValueFit::Gumbel::quantile(double p) const {
+    // P(block max <= x) = (1 - p)^B = exp(-exp(-(x - mu) / beta))
+    double logNoExceed = blockSize * std::log1p(-p);
+    return location - scale * std::log(-logNoExceed);
+}
+
+ExtremeValueFit::Gpd ExtremeValueFit::gpd() const {
+    Gpd g{false, 0, 0, 0, 0};
+    if (tail.size() < (size_t)MIN_TAIL + 1 || samples <= (long long)tail.size()) return g;
+
+    // Threshold: the smallest value kept; excesses of the others over it
+    auto heap = tail;
+    g.threshold = heap.top();
+    heap.pop();
+    std::vector<double> excess;
+    excess.reserve(heap.size());
+    while (!heap.empty()) {
+        excess.push_back(heap.top() - g.threshold);
+        heap.pop();
+    }
+
+    // Probability-weighted moments a0 = E[Y], a1 = E[Y (1 - F(Y))]
+    size_t k = excess.size();
+    double a0 = 0, a1 = 0;
+    for (size_t i = 0; i < k; i++) {
+        double plotting = (i + 1 - 0.35) / k;
+        a0 += excess[i];
+        a1 += (1.0 - plotting) * excess[i];
+    }
+    a0 /= k;
+    a1 /= k;
+    if (a0 <= 0 || a0 - 2 * a1 <= 0) return g;
+
+    // Hosking-Wallis parameters (their k is -xi)
+    double hwShape = a0 / (a0 - 2 * a1) - 2;
+    g.scale = 2 * a0 * a1 / (a0 - 2 * a1);
+    g.shape = -hwShape;
+    g.tailFraction = (double)k / samples;
+    g.valid = g.scale > 0;
+    return g;
+}
+
+double ExtremeValueFit::Gpd::quantile(double p) const {
+    // P(X > x) = tailFraction (1 + xi (x - u) / sigma)^(-1 / xi)
+    if (p >= tailFraction) return threshold;
+    double ratio = tailFraction / p;
+    if (std::fabs(shape) < 1e-9) return threshold + scale * std::log(ratio);
+    return threshold + scale / shape * (std::pow(ratio, shape) - 1.0);
+}
+
+double ExtremeValueFit::pwcet(double p) const {
+    double estimate = highest;
+    Gumbel g = gumbel();
+    if (g.valid) estimate = std::max(estimate, g.quantile(p));
+    Gpd t = gpd();
+    if (t.valid) estimate = std::max(estimate, t.quantile(p));
+    return estimate;
+}
@@ -0,0 +1,149 @@
+#include "../../include/analysis/HolisticAnalysis.h"
+#include "../../include/analysis/SchedulabilityAnalysis.h"
+#include <algorithm>
+
+namespace {
+
+// A step as a task of its node, with the jitter of the current iteration
+struct Entry {
+    size_t index; // Into the flattened step list
+    int computationTime;
+    int period;
+    int priority; // Smaller is higher (RM: period, DM: local deadline)
+};
+
+long long ceilDiv(long long a, long long b) { return (a + b - 1) / b; }
+
+// Worst response of node[self] after its earliest release: busy windows of
+// q + 1 jobs until one closes before the next job can arrive. -1 past limit.
+long long fixedPriorityResponse(const std::vector<Entry>& node, size_t self,
+                                const std::vector<long long>& jitter, long long limit) {
+    const Entry& me = node[self];
+    long long ownJitter = jitter[me.index];
+    long long worst = 0;
+    for (long long q = 0;; q++) {
+        long long w = (q + 1) * me.computationTime;
+        while (true) {
+            long long next = (q + 1) * me.computationTime;
+            for (size_t j = 0; j < node.size(); j++) {
+                if (j == self || node[j].priority > me.priority) continue;
+                next += ceilDiv(w + jitter[node[j].index], node[j].period) * node[j].computationTime;
+            }
+            if (next == w) break;
+            w = next;
+            if (w > limit) return -1;
+        }
+        worst = std::max(worst, w - q * me.period + ownJitter);
+        if (w + ownJitter <= (q + 1) * me.period) return worst;
+    }
+}
+
+// Longest busy period of the node with every task released together at
+// its worst jitter. -1 past limit.
+long long busyPeriod(const std::vector<Entry>& node, const std::vector<long long>& jitter, long long limit) {
+    long long busy = 0;
+    for (const auto& e : node) busy += e.computationTime;
+    while (true) {
+        long long next = 0;
+        for (const auto& e : node) next += ceilDiv(busy + jitter[e.index], e.period) * e.computationTime;
+        if (next == busy) return busy;
+        busy = next;
+        if (busy > limit) return -1;
+    }
+}
+
+} // namespace
+
+double HolisticAnalysis::nodeUtilization(const DistributedSystem& system, int node) {
+    return SchedulabilityAnalysis::utilization(system.nodeTasks(node));
+}
+
+bool HolisticAnalysis::nodeTest(const DistributedSystem& system, const NodeSpec& node) {
+    return SchedulabilityAnalysis::isSchedulable(system.nodeTasks(node.id), node.algorithm, "Background");
+}
+
+HolisticAnalysis::Result HolisticAnalysis::analyse(const DistributedSystem& system) {
+    Result result;
+
+    // Flattened steps, and the tasks of every node
+    long long limit = 0;
+    for (const auto& tr : system.transactions) {
+        limit = std::max(limit, 10LL * (tr.deadline + tr.period));
+        for (size_t k = 0; k < tr.steps.size(); k++) {
+            result.steps.push_back({tr.id, k, tr.steps[k].taskId, tr.steps[k].node, 0, 0, 0});
+        }
+    }
+    std::vector<std::vector<Entry>> nodes(system.nodes.size());
+    std::vector<bool> dynamic(system.nodes.size());
+    size_t index = 0;
+    for (const auto& tr : system.transactions) {
+        for (const auto& step : tr.steps) {
+            for (size_t n = 0; n < system.nodes.size(); n++) {
+                if (system.nodes[n].id != step.node) continue;
+                AlgorithmKind kind = system.nodes[n].algorithm;
+                int priority = kind == AlgorithmKind::DeadlineMonotonic ? step.localDeadline : tr.period;
+                nodes[n].push_back({index, step.computationTime, tr.period, priority});
+                dynamic[n] = kind == AlgorithmKind::EDF || kind == AlgorithmKind::LeastSlackTime;
+            }
+            index++;
+        }
+    }
+
+    std::vector<long long> jitter(result.steps.size(), 0), local(result.steps.size(), 0);
+    bool bounded = true;
+    while (bounded) {
+        result.iterations++;
+
+        // 1. Local responses (after the earliest release) under the current jitter
+        for (size_t n = 0; n < nodes.size() && bounded; n++) {
+            long long busy = 0;
+            if (dynamic[n] && !nodes[n].empty()) busy = busyPeriod(nodes[n], jitter, limit);
+            for (size_t i = 0; i < nodes[n].size() && bounded; i++) {
+                size_t s = nodes[n][i].index;
+                local[s] = dynamic[n] ? (busy < 0 ? -1 : busy + jitter[s])
+                                      : fixedPriorityResponse(nodes[n], i, jitter, limit);
+                if (local[s] < 0) bounded = false;
+            }
+        }
+        if (!bounded) break;
+
+        // 2. Release windows down each transaction
+        bool changed = false;
+        size_t s = 0;
+        for (const auto& tr : system.transactions) {
+            long long best = 0, worst = 0; // Completion window of the step before
+            for (size_t k = 0; k < tr.steps.size(); k++, s++) {
+                long long offset = 0, nextJitter = 0;
+                if (k > 0) {
+                    int from = tr.steps[k - 1].node, to = tr.steps[k].node;
+                    offset = best + system.minLatency(from, to);
+                    nextJitter = worst + system.maxLatency(from, to) - offset;
+                }
+                if (nextJitter != jitter[s]) changed = true;
+                jitter[s] = nextJitter;
+                result.steps[s].offset = (int)offset;
+                result.steps[s].jitter = (int)nextJitter;
+                result.steps[s].response = (int)(offset + local[s]);
+                best = offset + tr.steps[k].computationTime;
+                worst = offset + local[s];
+                if (worst > limit) bounded = false;
+            }
+        }
+        if (!changed) break;
+    }
+
+    result.schedulable = bounded;
+    size_t s = 0;
+    for (const auto& tr : system.transactions) {
+        if (!bounded) {
+            for (size_t k = 0; k < tr.steps.size(); k++) result.steps[s++].response = -1;
+            result.endToEnd.push_back(-1);
+            continue;
+        }
+        s += tr.steps.size();
+        int e2e = result.steps[s - 1].response;
+        result.endToEnd.push_back(e2e);
+        if (e2e > tr.deadline) result.schedulable = false;
+    }
+    return result;
+}
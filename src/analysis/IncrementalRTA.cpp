@@ -0,0 +1,202 @@
+#include "../../include/analysis/IncrementalRTA.h"
+#include "../../include/analysis/SchedulabilityAnalysis.h"
+#include <algorithm>
+
+IncrementalRTA::IncrementalRTA(AlgorithmKind kind)
+    : kind(kind), missing(0), version(0), lastIterations(0) {
+    probe.version = -1;
+}
+
+bool IncrementalRTA::higherPriority(const Task& a, const Task& b) const {
+    return StaticAnalysis::precedes(a, b, kind == AlgorithmKind::DeadlineMonotonic);
+}
+
+int IncrementalRTA::indexOf(int taskId) const {
+    for (size_t i = 0; i < levels.size(); i++) {
+        if (levels[i].task.id == taskId) return (int)i;
+    }
+    return -1;
+}
+
+int IncrementalRTA::responseTime(int taskId) const {
+    int i = indexOf(taskId);
+    return i < 0 ? -1 : levels[i].responseTime;
+}
+
+long long IncrementalRTA::lowerBound(const Task& task, size_t hpCount) const {
+    long long r = task.computationTime;
+    for (size_t j = 0; j < hpCount; j++) r += levels[j].task.computationTime;
+    return r;
+}
+
+int IncrementalRTA::solve(const Task& task, size_t hpCount, long long start) const {
+    // A self-suspending level above that misses leaves its interference unbounded
+    for (size_t j = 0; j < hpCount; j++) {
+        if (levels[j].task.selfSuspending() && levels[j].responseTime < 0) return -1;
+    }
+
+    auto demand = [](const Entry& hp, long long r) -> long long {
+        if (hp.task.period <= 0) return hp.task.computationTime;
+        long long window = r + SchedulabilityAnalysis::interferenceJitter(hp.task, hp.responseTime);
+        return ((window + hp.task.period - 1) / hp.task.period) * hp.task.computationTime;
+    };
+    long long suspension = task.suspensionTime();
+
+    // Least fixed point of the window of q + 1 jobs from `w`; -1 once the
+    // q-th job would miss its deadline
+    auto window = [&](long long q, long long w) -> long long {
+        while (w - q * task.period + task.jitter <= task.relativeDeadline) {
+            lastIterations++;
+            long long next = (q + 1) * task.computationTime + suspension;
+            for (size_t j = 0; j < hpCount; j++) next += demand(levels[j], w);
+            if (next == w) return w;
+            w = next;
+        }
+        return -1;
+    };
+
+    long long w = window(0, start);
+    if (w < 0) return -1;
+    long long worst = w + task.jitter;
+    if (task.period <= 0 || w + task.jitter <= task.period) return (int)worst;
+    if (suspension > 0) return -1; // Self-suspending jobs must finish before the next release
+
+    // The next job arrives while the window is still open (deadline past
+    // the period, or jitter): follow the busy window job by job
+    double load = (double)task.computationTime / task.period;
+    bool jittered = task.jitter > 0;
+    auto account = [&](const Entry& hp) {
+        if (hp.task.period > 0) load += (double)hp.task.computationTime / hp.task.period;
+        if (SchedulabilityAnalysis::interferenceJitter(hp.task, hp.responseTime) > 0) jittered = true;
+    };
+    for (size_t j = 0; j < hpCount; j++) account(levels[j]);
+    if (jittered && load > 1.0 - 1e-9) return -1; // The window never closes
+
+    for (long long q = 1;; q++) {
+        w = window(q, q * task.computationTime + lowerBound(task, hpCount));
+        if (w < 0) return -1;
+        worst = std::max(worst, w - q * task.period + task.jitter);
+        if (w + task.jitter <= (q + 1) * task.period) return (int)worst;
+    }
+}
+
+long long IncrementalRTA::resumeFrom(const Entry& e, size_t hpCount, int added) const {
+    // With d <= p a response within the deadline is that of the first job,
+    // so response - jitter is its old window
+    if (e.responseTime >= 0 && e.task.relativeDeadline <= e.task.period) {
+        return (long long)e.responseTime - e.task.jitter + added;
+    }
+    return lowerBound(e.task, hpCount);
+}
+
+void IncrementalRTA::recompute(size_t from, int added) {
+    version++;
+    for (size_t i = from; i < levels.size(); i++) {
+        Entry& e = levels[i];
+        int before = e.responseTime;
+
+        // More interference can't rescue a level that already misses
+        if (added > 0 && before < 0) continue;
+
+        // Extra demand of `added` ticks in every window: the new fixed point
+        // is at least the old one plus that much
+        long long start = added > 0 ? resumeFrom(e, i, added) : lowerBound(e.task, i);
+        e.responseTime = solve(e.task, i, start);
+
+        if (before < 0 && e.responseTime >= 0) missing--;
+        if (before >= 0 && e.responseTime < 0) missing++;
+    }
+}
+
+void IncrementalRTA::addTask(const Task& task) {
+    lastIterations = 0;
+
+    // Reuse the response times admits() just computed for this very task
+    bool reuse = probe.version == version && probe.task.id == task.id &&
+                 probe.task.computationTime == task.computationTime && probe.task.period == task.period &&
+                 probe.task.relativeDeadline == task.relativeDeadline && probe.task.jitter == task.jitter &&
+                 probe.task.suspensionTime() == task.suspensionTime();
+    size_t k = insertionPoint(task);
+
+    levels.insert(levels.begin() + k, {task, 0});
+    if (!reuse) {
+        levels[k].responseTime = solve(task, k, lowerBound(task, k));
+        if (levels[k].responseTime < 0) missing++;
+        recompute(k + 1, task.computationTime);
+        return;
+    }
+
+    version++;
+    for (size_t i = k; i < levels.size(); i++) {
+        int before = i == k ? 0 : levels[i].responseTime;
+        levels[i].responseTime = probe.responses[i - k];
+        if (i == k && levels[i].responseTime < 0) missing++;
+        if (i > k && before >= 0 && levels[i].responseTime < 0) missing++;
+    }
+}
+
+bool IncrementalRTA::removeTask(int taskId) {
+    lastIterations = 0;
+    int k = indexOf(taskId);
+    if (k < 0) return false;
+
+    if (levels[k].responseTime < 0) missing--;
+    levels.erase(levels.begin() + k);
+    recompute(k, 0);
+    return true;
+}
+
+bool IncrementalRTA::updateWCET(int taskId, int computationTime) {
+    lastIterations = 0;
+    int k = indexOf(taskId);
+    if (k < 0) return false;
+
+    int before = levels[k].task.computationTime;
+    if (before == computationTime) return true;
+    levels[k].task.computationTime = computationTime;
+    recompute(k, std::max(0, computationTime - before));
+    return true;
+}
+
+size_t IncrementalRTA::insertionPoint(const Task& task) const {
+    // After every task of equal priority (first come, first served on ties),
+    // but before a server of equal priority
+    size_t k = 0;
+    while (k < levels.size() && !higherPriority(task, levels[k].task)) k++;
+    return k;
+}
+
+bool IncrementalRTA::admits(const Task& task, std::vector<int>& violations, int& responseTime) {
+    lastIterations = 0;
+    size_t k = insertionPoint(task);
+
+    // Tentative insert: levels below see the candidate and each other's new
+    // response times (the jitter of a self-suspending level follows its
+    // own). Only k and below are touched, and they are rolled back after.
+    saved.clear();
+    for (size_t i = k; i < levels.size(); i++) saved.push_back(levels[i].responseTime);
+    int savedMissing = missing;
+    long long savedVersion = version;
+
+    levels.insert(levels.begin() + k, {task, solve(task, k, lowerBound(task, k))});
+    if (levels[k].responseTime < 0) missing++;
+    recompute(k + 1, task.computationTime);
+
+    violations.clear();
+    for (const auto& e : levels) {
+        if (e.responseTime < 0) violations.push_back(e.task.id);
+    }
+    responseTime = levels[k].responseTime;
+
+    probe.task = task;
+    probe.responses.clear();
+    for (size_t i = k; i < levels.size(); i++) probe.responses.push_back(levels[i].responseTime);
+
+    // Roll back
+    levels.erase(levels.begin() + k);
+    for (size_t i = k; i < levels.size(); i++) levels[i].responseTime = saved[i - k];
+    missing = savedMissing;
+    version = savedVersion;
+    probe.version = version;
+    return violations.empty();
+}
@@ -0,0 +1,219 @@
+#include "../../include/analysis/ProbabilisticRTA.h"
+#include "../../include/analysis/SchedulabilityAnalysis.h"
+#include <complex>
+#include <cmath>
+#include <algorithm>
+
+namespace {
+
+using Complex = std::complex<double>;
+
+// Below this length on either side the direct O(n m) sum is faster
+const size_t FFT_THRESHOLD = 64;
+
+void fft(std::vector<Complex>& a, bool inverse) {
+    size_t n = a.size();
+    for (size_t i = 1, j = 0; i < n; i++) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if (i < j) std::swap(a[i], a[j]);
+    }
+
+    // Twiddles computed directly (not by repeated multiplication) to keep
+    // the error flat across long transforms
+    const double pi = 3.14159265358979323846;
+    std::vector<Complex> roots(n / 2);
+    for (size_t k = 0; k < n / 2; k++) {
+        double angle = 2 * pi * k / n * (inverse ? 1 : -1);
+        roots[k] = Complex(std::cos(angle), std::sin(angle));
+    }
+    for (size_t len = 2; len <= n; len <<= 1) {
+        size_t stride = n / len;
+        for (size_t i = 0; i < n; i += len) {
+            for (size_t k = 0; k < len / 2; k++) {
+                Complex u = a[i + k];
+                Complex v = a[i + k + len / 2] * roots[k * stride];
+                a[i + k] = u + v;
+                a[i + k + len / 2] = u - v;
+            }
+        }
+    }
+    if (inverse) {
+        for (auto& x : a) x /= (double)n;
+    }
+}
+
+double sum(const std::vector<double>& v, size_t from = 0) {
+    double s = 0;
+    for (size_t k = from; k < v.size(); k++) s += v[k];
+    return s;
+}
+
+void trimZeros(std::vector<double>& v) {
+    while (!v.empty() && v.back() <= 0) v.pop_back();
+}
+
+// Execution time of a task on the grid (plus `extra` ticks): values rounded
+// up to the next multiple of step, anything past `points` grid points is overflow
+ProbabilisticRTA::Distribution execution(const Task& task, const std::map<int, ExecutionProfileReader::Profile>& profiles,
+                                         int step, size_t points, int extra = 0) {
+    ProbabilisticRTA::Distribution d;
+    d.step = step;
+    auto place = [&](int ticks, double probability) {
+        size_t k = (size_t)((ticks + step - 1) / step);
+        if (k >= points) { d.overflow += probability; return; }
+        if (d.p.size() <= k) d.p.resize(k + 1, 0.0);
+        d.p[k] += probability;
+    };
+
+    auto it = profiles.find(task.id);
+    if (it != profiles.end() && !it->second.points.empty()) {
+        for (const auto& [ticks, probability] : it->second.points) place(ticks + extra, probability);
+    } else {
+        place(task.computationTime + extra, 1.0);
+    }
+    return d;
+}
+
+// a (+) b, keeping `points` grid points; the rest joins the overflow
+void accumulate(ProbabilisticRTA::Distribution& a, const ProbabilisticRTA::Distribution& b, size_t points,
+                ProbabilisticRTA::Result& result) {
+    bool usedFft = false;
+    double inRange = sum(a.p);
+    std::vector<double> c = ProbabilisticRTA::convolve(a.p, b.p, usedFft);
+    result.convolutions++;
+    if (usedFft) result.fftConvolutions++;
+
+    a.overflow += inRange * b.overflow;
+    if (c.size() > points) {
+        a.overflow += sum(c, points);
+        c.resize(points);
+    }
+    a.p = std::move(c);
+    trimZeros(a.p);
+}
+
+} // namespace
+
+int ProbabilisticRTA::Distribution::quantile(double q) const {
+    double cumulative = 0;
+    for (size_t k = 0; k < p.size(); k++) {
+        cumulative += p[k];
+        if (cumulative >= q - 1e-12) return (int)(k * step);
+    }
+    return -1;
+}
+
+std::vector<double> ProbabilisticRTA::convolve(const std::vector<double>& a, const std::vector<double>& b,
+                                               bool& usedFft) {
+    usedFft = false;
+    if (a.empty() || b.empty()) return {};
+    size_t size = a.size() + b.size() - 1;
+
+    if (std::min(a.size(), b.size()) < FFT_THRESHOLD) {
+        std::vector<double> c(size, 0.0);
+        for (size_t i = 0; i < a.size(); i++) {
+            if (a[i] == 0) continue;
+            for (size_t j = 0; j < b.size(); j++) c[i + j] += a[i] * b[j];
+        }
+        return c;
+    }
+
+    usedFft = true;
+    size_t n = 1;
+    while (n < size) n <<= 1;
+    std::vector<Complex> fa(a.begin(), a.end()), fb(b.begin(), b.end());
+    fa.resize(n);
+    fb.resize(n);
+    fft(fa, false);
+    fft(fb, false);
+    for (size_t k = 0; k < n; k++) fa[k] *= fb[k];
+    fft(fa, true);
+
+    // Round-off shows up as tiny negative (or spurious) values; clamp them
+    std::vector<double> c(size);
+    for (size_t k = 0; k < size; k++) c[k] = std::max(0.0, fa[k].real());
+    return c;
+}
+
+bool ProbabilisticRTA::validate(const std::vector<Task>& tasks, std::string& error) {
+    for (const auto& t : tasks) {
+        if (t.relativeDeadline > t.period) {
+            error = "task " + std::to_string(t.id) + " has a deadline past its period";
+            return false;
+        }
+        if (t.jitter > 0) {
+            error = "task " + std::to_string(t.id) + " has a release jitter";
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<ProbabilisticRTA::Result> ProbabilisticRTA::analyse(
+    const std::vector<Task>& tasks, AlgorithmKind kind,
+    const std::map<int, ExecutionProfileReader::Profile>& profiles, int maxPoints) {
+    std::vector<Result> results;
+    std::string error;
+    if (!validate(tasks, error)) return results;
+
+    std::vector<Task> sorted = SchedulabilityAnalysis::priorityOrder(tasks, kind);
+    maxPoints = std::max(2, maxPoints);
+
+    for (size_t i = 0; i < sorted.size(); i++) {
+        const Task& task = sorted[i];
+        int deadline = std::max(1, task.relativeDeadline);
+
+        Result result{task.id, deadline, Distribution(), -1, true, 0, 0};
+        auto target = profiles.find(task.id);
+        if (target != profiles.end()) result.missTarget = target->second.missTarget;
+
+        // Grid: at most maxPoints points from 0 to the deadline
+        int step = (deadline + maxPoints - 2) / (maxPoints - 1);
+        size_t points = (size_t)(deadline / step) + 1;
+
+        std::vector<Distribution> hp;
+        for (size_t j = 0; j < i; j++) hp.push_back(execution(sorted[j], profiles, step, points));
+
+        // Critical instant: the job and one job of every higher-priority task at 0
+        Distribution& r = result.response;
+        r = execution(task, profiles, step, points, task.suspensionTime());
+        for (const auto& c : hp) accumulate(r, c, points, result);
+
+        // Later higher-priority releases inside the window, in time order
+        std::vector<std::pair<long long, size_t>> releases;
+        for (size_t j = 0; j < i; j++) {
+            const Task& t = sorted[j];
+            if (t.period <= 0) continue;
+            long long jitter = SchedulabilityAnalysis::releaseJitter(t);
+            if (t.selfSuspending()) jitter = std::max<long long>(jitter, t.relativeDeadline - t.computationTime);
+            for (long long k = 1; k * t.period - jitter < deadline; k++) {
+                releases.push_back({k * t.period - jitter, j});
+            }
+        }
+        std::sort(releases.begin(), releases.end());
+
+        for (const auto& [release, j] : releases) {
+            // Grid points k * step <= release have completed: no preemption
+            size_t cut = (size_t)(release / step) + 1;
+            if (cut >= r.p.size()) break; // Every in-range outcome is done
+
+            Distribution pending;
+            pending.step = step;
+            pending.p.assign(r.p.begin() + cut, r.p.end());
+            r.p.resize(cut);
+
+            // Convolve the pending part at offset `cut`, then add it back
+            accumulate(pending, hp[j], points - cut, result);
+            r.overflow += pending.overflow;
+            if (r.p.size() < cut + pending.p.size()) r.p.resize(cut + pending.p.size(), 0.0);
+            for (size_t k = 0; k < pending.p.size(); k++) r.p[cut + k] += pending.p[k];
+            trimZeros(r.p);
+        }
+
+        result.meetsTarget = result.missTarget < 0 || r.overflow <= result.missTarget;
+        results.push_back(result);
+    }
+    return results;
+}
@@ -0,0 +1,179 @@
+#include "../../include/analysis/QueueingEstimator.h"
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <numeric>
+
+namespace {
+
+const double INF = std::numeric_limits<double>::infinity();
+const long long MAX_VACATION_JOBS = 100000; // Per hyperperiod, for vacationsOf()
+
+// Does a periodic task preempt the server? Equal keys go to the task,
+// as in SchedulabilityAnalysis::priorityOrder with the server added last.
+bool outranksServer(const Task& task, AlgorithmKind kind, int period) {
+    if (kind == AlgorithmKind::RateMonotonic) return task.period <= period;
+    return task.relativeDeadline <= period;
+}
+
+struct Vacations {
+    double residual;   // q E[R] = q E[V^2] / 2E[V], for the residual R
+    double residualSq; // q E[R^2] = q E[V^3] / 3E[V]
+};
+
+// A vacation of length b, in progress with probability weight. The residual
+// R is uniform on [0, b]; with a cap (the next poll, uniform on [0, cap])
+// the wait is min(R, U): for a = min(b, cap),
+//   E[min] = a - a^2 (1/b + 1/cap) / 2 + a^3 / (3 b cap)
+//   E[min^2] = a^2 - 2 a^3 (1/b + 1/cap) / 3 + a^4 / (2 b cap)
+void addVacation(Vacations& v, double b, double weight, double cap) {
+    if (b <= 0) return;
+    if (cap <= 0) {
+        v.residual += weight * b / 2.0;
+        v.residualSq += weight * b * b / 3.0;
+        return;
+    }
+    double a = std::min(b, cap), inv = 1.0 / b + 1.0 / cap;
+    v.residual += weight * (a - a * a * inv / 2.0 + a * a * a / (3.0 * b * cap));
+    v.residualSq += weight * (a * a - 2.0 * a * a * a * inv / 3.0 + a * a * a * a / (2.0 * b * cap));
+}
+
+// Vacations as the busy periods B of the given tasks on their own (jobs
+// back to back from their release offsets): an arrival lands in one with
+// probability B / H, so uncapped q E[V^2] / 2E[V] = sum B^2 / 2H and
+// q E[R^2] = sum B^3 / 3H. Measured over the second hyperperiod, where the
+// pattern repeats. Past MAX_VACATION_JOBS jobs per hyperperiod, single jobs
+// instead (V = C, in progress with probability C / T).
+Vacations vacationsOf(const std::vector<Task>& tasks, double cap) {
+    Vacations v{0.0, 0.0};
+    long long hyperperiod = 1, jobs = 0;
+    int phase = 0;
+    for (const auto& t : tasks) {
+        addVacation(v, t.computationTime, (double)t.computationTime / t.period, cap);
+        if (hyperperiod <= MAX_VACATION_JOBS * 1000LL) hyperperiod = std::lcm(hyperperiod, (long long)t.period);
+        phase = std::max(phase, t.releaseTime);
+    }
+    if (hyperperiod > MAX_VACATION_JOBS * 1000LL) return v;
+    for (const auto& t : tasks) jobs += hyperperiod / t.period;
+    if (jobs > MAX_VACATION_JOBS) return v;
+
+    long long from = phase + hyperperiod, to = phase + 2 * hyperperiod;
+    std::vector<std::pair<long long, int>> releases;
+    for (const auto& t : tasks) {
+        for (long long r = t.releaseTime; r < to; r += t.period) releases.push_back({r, t.computationTime});
+    }
+    std::sort(releases.begin(), releases.end());
+
+    v = {0.0, 0.0};
+    long long start = -1, end = -1;
+    auto close = [&]() {
+        if (start < from || start >= to) return;
+        addVacation(v, (double)(end - start), (double)(end - start) / hyperperiod, cap);
+    };
+    for (const auto& r : releases) {
+        if (r.first >= end) {
+            close();
+            start = end = r.first;
+        }
+        end += r.second;
+    }
+    close();
+    return v;
+}
+
+// Standard normal quantile by bisection on erfc (|z| <= 10)
+double normalQuantile(double p) {
+    double lo = -10, hi = 10;
+    for (int i = 0; i < 80; i++) {
+        double mid = (lo + hi) / 2;
+        if (0.5 * std::erfc(-mid / std::sqrt(2.0)) < p) lo = mid;
+        else hi = mid;
+    }
+    return (lo + hi) / 2;
+}
+
+} // namespace
+
+QueueingEstimator::Estimate QueueingEstimator::estimate(const Workload& workload, const std::string& policy,
+                                                        const std::vector<Task>& periodicTasks, AlgorithmKind kind,
+                                                        int capacity, int period) {
+    Estimate e{false, INF, INF, INF, INF, INF};
+    bool server = (policy == "Poller" || policy == "Deferrable") && capacity > 0 && period > 0;
+
+    double busy = 0, hp = 0;
+    std::vector<Task> all, above;
+    for (const auto& t : periodicTasks) {
+        if (t.period <= 0) continue;
+        busy += (double)t.computationTime / t.period;
+        all.push_back(t);
+        if (server && outranksServer(t, kind, period)) {
+            hp += (double)t.computationTime / t.period;
+            above.push_back(t);
+        }
+    }
+    double share = 1.0 - busy;
+    double m = workload.meanExec;
+    if (share <= 0 || m <= 0) return e;
+
+    double lambda = std::max(0.0, workload.rate);
+    e.load = lambda * m / share;
+    if (e.load >= 1.0) return e;
+    e.stable = true;
+
+    // Polling: a job arriving at an idle server waits out the periodic
+    // busy period in progress, up to the next poll. Otherwise only the
+    // tasks above the server stop it.
+    Vacations arrival = server && policy == "Poller" ? vacationsOf(all, period)
+                                                     : vacationsOf(server ? above : all, 0.0);
+    double residual = arrival.residual;
+    double vacationVariance = arrival.residualSq - residual * residual;
+
+    double stretch = 1.0 / share; // k: wall time per tick of service
+    e.service = m / share;
+    if (server) {
+        double budget = capacity * (1.0 - e.load / 2.0);
+        double head = m * (1.0 - std::exp(-budget / m)); // E[min(S, budget)] for exponential S
+        e.service = head / (1.0 - hp) + (m - head) / share;
+        stretch = e.service / m;
+    }
+    double secondX = workload.secondMoment * stretch * stretch;
+    double pkWait = e.load * secondX / (2.0 * e.service * (1.0 - e.load));
+    e.queueWait = pkWait + residual;
+    e.meanResponse = e.queueWait + e.service;
+
+    // PK wait: atom 1 - rho at 0, exponential tail of mass rho => E[W^2] = 2 W^2 / rho
+    double varWait = e.load > 0 ? pkWait * pkWait * (2.0 / e.load - 1.0) : 0.0;
+    double varService = std::max(0.0, secondX - e.service * e.service);
+    e.variance = varWait + std::max(0.0, vacationVariance) + varService;
+    return e;
+}
+
+double QueueingEstimator::Estimate::percentile(double p) const {
+    if (!stable) return INF;
+    p = std::min(std::max(p, 1e-9), 1.0 - 1e-9);
+    if (variance <= 0 || meanResponse <= 0) return meanResponse;
+
+    // Log-normal with the same mean and variance
+    double s2 = std::log(1.0 + variance / (meanResponse * meanResponse));
+    double mu = std::log(meanResponse) - s2 / 2.0;
+    return std::exp(mu + std::sqrt(s2) * normalQuantile(p));
+}
+
+QueueingEstimator::Workload QueueingEstimator::fromArrivals(const std::vector<Task>& aperiodicTasks) {
+    Workload w{0.0, 0.0, 0.0};
+    if (aperiodicTasks.empty()) return w;
+
+    int first = aperiodicTasks[0].releaseTime, last = first;
+    for (const auto& t : aperiodicTasks) {
+        first = std::min(first, t.releaseTime);
+        last = std::max(last, t.releaseTime);
+        w.meanExec += t.computationTime;
+        w.secondMoment += (double)t.computationTime * t.computationTime;
+    }
+    size_t n = aperiodicTasks.size();
+    w.meanExec /= n;
+    w.secondMoment /= n;
+    // n arrivals span n - 1 gaps
+    if (n >= 2 && last > first) w.rate = (n - 1) / (double)(last - first);
+    return w;
+}
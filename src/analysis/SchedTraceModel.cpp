@@ -0,0 +1,90 @@
+#include "../../include/analysis/SchedTraceModel.h"
+#include <algorithm>
+
+uint64_t SchedTraceModel::Thread::period() const {
+    if (gaps.empty()) return 0;
+    std::vector<uint64_t> sorted = gaps;
+    std::nth_element(sorted.begin(), sorted.begin() + sorted.size() / 2, sorted.end());
+    return sorted[sorted.size() / 2];
+}
+
+void SchedTraceModel::release(int pid, uint64_t t) {
+    Open& state = open[pid];
+    if (state.active) return; // Woken again while still runnable: same job
+    state.active = true;
+    state.running = false;
+    state.release = t;
+    state.start = 0;
+    state.execution = 0;
+
+    Thread& thread = byPid[pid];
+    thread.pid = pid;
+    if (state.released) {
+        if (thread.gaps.size() < GAP_SAMPLES) thread.gaps.push_back(t - state.lastRelease);
+    } else {
+        thread.firstRelease = t;
+    }
+    state.lastRelease = t;
+    state.released = true;
+}
+
+void SchedTraceModel::complete(int pid, Open& state, uint64_t t) {
+    Thread& thread = byPid[pid];
+    uint64_t response = t - state.release;
+    thread.jobs++;
+    thread.maxExecution = std::max(thread.maxExecution, state.execution);
+    thread.sumExecution += (double)state.execution;
+    thread.maxResponse = std::max(thread.maxResponse, response);
+    thread.sumResponse += (double)response;
+    if (thread.log.size() < JOB_LOG_LIMIT) thread.log.push_back({state.release, state.start, t, state.execution});
+    state.active = false;
+    state.running = false;
+}
+
+void SchedTraceModel::add(const SchedTraceReader::Event& event) {
+    uint64_t t = event.timestamp;
+    if (!seen) { first = t; seen = true; }
+    last = std::max(last, t);
+
+    if (event.kind == SchedTraceReader::Event::Kind::Wakeup) {
+        if (event.pid == 0) return;
+        release(event.pid, t);
+        Thread& thread = byPid[event.pid];
+        if (thread.comm != event.comm) thread.comm.assign(event.comm.data(), event.comm.size());
+        return;
+    }
+
+    // Switch out
+    if (event.prevPid != 0) {
+        auto it = open.find(event.prevPid);
+        if (it != open.end() && it->second.running) {
+            Open& state = it->second;
+            state.execution += t - state.runSince;
+            state.running = false;
+            if (!event.prevRunnable) complete(event.prevPid, state, t);
+        }
+    }
+
+    // Switch in
+    if (event.pid != 0) {
+        if (!open[event.pid].active) release(event.pid, t);
+        Open& state = open[event.pid];
+        if (state.start == 0) state.start = t;
+        state.running = true;
+        state.runSince = t;
+        Thread& thread = byPid[event.pid];
+        if (thread.comm != event.comm) thread.comm.assign(event.comm.data(), event.comm.size());
+    }
+}
+
+std::vector<const SchedTraceModel::Thread*> SchedTraceModel::threads(long long minJobs) const {
+    std::vector<const Thread*> result;
+    for (const auto& [pid, thread] : byPid) {
+        if (pid != 0 && thread.jobs >= std::max(1LL, minJobs)) result.push_back(&thread);
+    }
+    std::sort(result.begin(), result.end(), [](const Thread* a, const Thread* b) {
+        if (a->jobs != b->jobs) return a->jobs > b->jobs;
+        return a->pid < b->pid;
+    });
+    return result;
+}
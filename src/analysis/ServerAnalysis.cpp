@@ -0,0 +1,60 @@
+#include "../../include/analysis/ServerAnalysis.h"
+#include "../../include/analysis/SchedulabilityAnalysis.h"
+#include "../../include/core/Scheduler.h"
+
+std::vector<Task> ServerAnalysis::withServer(const std::vector<Task>& periodicTasks, const std::string& policy,
+                                             int capacity, int period) {
+    std::vector<Task> tasks = periodicTasks;
+    TaskType type = policy == "Deferrable" ? TaskType::DeferrableServer : TaskType::Poller;
+    tasks.push_back(Task(SERVER_TASK_ID, type, 0, capacity, period, period));
+    return tasks;
+}
+
+ServerAnalysis::Bound ServerAnalysis::aperiodicBound(const std::vector<Task>& periodicTasks, AlgorithmKind kind,
+                                                     const std::string& policy, int work, int capacity, int period) {
+    Bound bound{-1, 0, -1};
+    if (capacity <= 0 || period <= 0 || capacity > period || work <= 0) return bound;
+
+    bound.periods = (work + capacity - 1) / capacity;
+    int last = work - (bound.periods - 1) * capacity;
+
+    std::vector<Task> tasks = withServer(periodicTasks, policy, capacity, period);
+    bool fixedPriority = kind == AlgorithmKind::RateMonotonic || kind == AlgorithmKind::DeadlineMonotonic;
+
+    int lastResponse = -1;
+    bool highest = false;
+    if (fixedPriority) {
+        std::vector<Task> sorted = SchedulabilityAnalysis::priorityOrder(tasks, kind);
+        size_t index = 0;
+        while (sorted[index].id != SERVER_TASK_ID) index++;
+        highest = index == 0;
+
+        bound.serverResponse = SchedulabilityAnalysis::responseTime(sorted, index, period);
+        sorted[index].computationTime = last;
+        lastResponse = SchedulabilityAnalysis::responseTime(sorted, index, period);
+    } else if (SchedulabilityAnalysis::demandBoundTest(tasks)) {
+        bound.serverResponse = period;
+        lastResponse = period;
+    }
+    if (bound.serverResponse < 0 || lastResponse < 0) return bound;
+
+    long long r = (long long)bound.periods * period + lastResponse;
+    if (policy == "Deferrable" && highest) r -= capacity;
+    bound.responseTime = (int)r;
+    return bound;
+}
+
+int ServerAnalysis::minimumCapacity(const std::vector<Task>& periodicTasks, AlgorithmKind kind,
+                                    const std::string& policy, int work, int period, int target) {
+    bool fixedPriority = kind == AlgorithmKind::RateMonotonic || kind == AlgorithmKind::DeadlineMonotonic;
+    for (int capacity = 1; capacity <= period; capacity++) {
+        std::vector<Task> tasks = withServer(periodicTasks, policy, capacity, period);
+        bool schedulable = fixedPriority ? SchedulabilityAnalysis::fixedPriorityTest(tasks, kind)
+                                         : SchedulabilityAnalysis::demandBoundTest(tasks);
+        if (!schedulable) continue;
+
+        Bound bound = aperiodicBound(periodicTasks, kind, policy, work, capacity, period);
+        if (bound.responseTime >= 0 && bound.responseTime <= target) return capacity;
+    }
+    return -1;
+}
@@ -0,0 +1,170 @@
+#include "../../include/core/DispatchTable.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <map>
+
+namespace {
+
+const char MAGIC[8] = {'R', 'T', 'D', 'T', '1', 0, 0, 0};
+
+} // namespace
+
+uint32_t DispatchTable::addBlock(uint32_t length, const std::vector<Slot>& blockSlots) {
+    for (uint32_t b = 0; b < blocks.size(); b++) {
+        const Block& block = blocks[b];
+        if (block.length != length || block.slotCount != blockSlots.size()) continue;
+        bool same = true;
+        for (uint32_t i = 0; i < block.slotCount && same; i++) {
+            const Slot& a = slots[block.firstSlot + i];
+            const Slot& c = blockSlots[i];
+            same = a.offset == c.offset && a.taskId == c.taskId && a.duration == c.duration;
+        }
+        if (same) return b;
+    }
+
+    blocks.push_back({length, (uint32_t)slots.size(), (uint32_t)blockSlots.size()});
+    slots.insert(slots.end(), blockSlots.begin(), blockSlots.end());
+    return (uint32_t)blocks.size() - 1;
+}
+
+DispatchTable DispatchTable::compile(const std::vector<int32_t>& timeline, uint32_t ticksPerUnit) {
+    DispatchTable best;
+    best.ticksPerUnit = ticksPerUnit;
+    uint32_t cycle = (uint32_t)timeline.size();
+    best.cycleLength = cycle;
+    if (cycle == 0) return best;
+
+    // Largest frames first so ties keep the fewest steps
+    for (uint32_t frame = cycle; frame >= 1; frame--) {
+        if (cycle % frame != 0) continue;
+
+        DispatchTable table;
+        table.cycleLength = cycle;
+        table.ticksPerUnit = ticksPerUnit;
+        table.frameSize = frame;
+
+        std::vector<Slot> frameSlots;
+        for (uint32_t start = 0; start < cycle; start += frame) {
+            frameSlots.clear();
+            for (uint32_t t = start; t < start + frame; t++) {
+                int32_t task = timeline[t];
+                if (task < 0) continue;
+                if (!frameSlots.empty() && frameSlots.back().taskId == task &&
+                    frameSlots.back().offset + frameSlots.back().duration == t - start) {
+                    frameSlots.back().duration++;
+                } else {
+                    frameSlots.push_back({t - start, task, 1});
+                }
+            }
+            table.steps.push_back({start, table.addBlock(frame, frameSlots)});
+        }
+
+        if (best.steps.empty() || table.encodedSize() < best.encodedSize()) best = std::move(table);
+    }
+    return best;
+}
+
+int DispatchTable::taskAt(uint32_t t) const {
+    t %= std::max<uint32_t>(1, cycleLength);
+    auto it = std::upper_bound(steps.begin(), steps.end(), t,
+                               [](uint32_t time, const Step& s) { return time < s.start; });
+    if (it == steps.begin()) return -1;
+    const Step& step = *(it - 1);
+    const Block& block = blocks[step.block];
+    uint32_t local = t - step.start;
+    for (uint32_t i = 0; i < block.slotCount; i++) {
+        const Slot& s = slots[block.firstSlot + i];
+        if (local >= s.offset && local < s.offset + s.duration) return s.taskId;
+    }
+    return -1;
+}
+
+std::vector<std::pair<int, uint32_t>> DispatchTable::busyTicks() const {
+    std::map<int, uint32_t> busy;
+    for (const auto& step : steps) {
+        const Block& block = blocks[step.block];
+        for (uint32_t i = 0; i < block.slotCount; i++) {
+            const Slot& s = slots[block.firstSlot + i];
+            busy[s.taskId] += s.duration;
+        }
+    }
+    return std::vector<std::pair<int, uint32_t>>(busy.begin(), busy.end());
+}
+
+bool DispatchTable::writeBinary(const std::string& path) const {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) return false;
+
+    auto put = [&out](uint32_t v) { out.write(reinterpret_cast<const char*>(&v), 4); };
+    out.write(MAGIC, 8);
+    put(cycleLength);
+    put(ticksPerUnit);
+    put(frameSize);
+    put((uint32_t)blocks.size());
+    put((uint32_t)slots.size());
+    put((uint32_t)steps.size());
+    for (const auto& b : blocks) { put(b.length); put(b.firstSlot); put(b.slotCount); }
+    for (const auto& s : slots) { put(s.offset); put((uint32_t)s.taskId); put(s.duration); }
+    for (const auto& s : steps) { put(s.start); put(s.block); }
+    return (bool)out;
+}
+
+bool DispatchTable::readBinary(const std::string& path, DispatchTable& table) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in.is_open()) return false;
+
+    char magic[8];
+    uint32_t header[6];
+    in.read(magic, 8);
+    in.read(reinterpret_cast<char*>(header), sizeof(header));
+    if (!in || std::memcmp(magic, MAGIC, 8) != 0) return false;
+
+    table.cycleLength = header[0];
+    table.ticksPerUnit = header[1];
+    table.frameSize = header[2];
+    table.blocks.resize(header[3]);
+    table.slots.resize(header[4]);
+    table.steps.resize(header[5]);
+
+    auto get = [&in]() { uint32_t v = 0; in.read(reinterpret_cast<char*>(&v), 4); return v; };
+    for (auto& b : table.blocks) { b.length = get(); b.firstSlot = get(); b.slotCount = get(); }
+    for (auto& s : table.slots) { s.offset = get(); s.taskId = (int32_t)get(); s.duration = get(); }
+    for (auto& s : table.steps) { s.start = get(); s.block = get(); }
+    return (bool)in;
+}
+
+bool DispatchTable::writeHeader(const std::string& path, const std::string& name, const std::string& comment) const {
+    std::ofstream out(path, std::ios::trunc);
+    if (!out.is_open()) return false;
+
+    out << "// Generated by rt_scheduler: " << comment << "\n";
+    out << "// Do not edit. Times are in ticks (" << ticksPerUnit << " ticks = 1 time unit).\n";
+    out << "#pragma once\n#include <cstdint>\n\n";
+    out << "namespace " << name << " {\n\n";
+    out << "struct Slot { uint32_t offset; int32_t taskId; uint32_t duration; };\n";
+    out << "struct Block { uint32_t length; uint32_t firstSlot; uint32_t slotCount; };\n";
+    out << "struct Step { uint32_t start; uint32_t block; };\n\n";
+    out << "constexpr uint32_t CYCLE_LENGTH = " << cycleLength << ";\n";
+    out << "constexpr uint32_t TICKS_PER_UNIT = " << ticksPerUnit << ";\n";
+    out << "constexpr uint32_t FRAME_SIZE = " << frameSize << "; // 0 = steps of varying length\n\n";
+
+    out << "constexpr Slot SLOTS[] = {\n";
+    for (const auto& s : slots) out << "    {" << s.offset << ", " << s.taskId << ", " << s.duration << "},\n";
+    if (slots.empty()) out << "    {0, -1, 0},\n";
+    out << "};\n\n";
+
+    out << "constexpr Block BLOCKS[] = {\n";
+    for (const auto& b : blocks) out << "    {" << b.length << ", " << b.firstSlot << ", " << b.slotCount << "},\n";
+    if (blocks.empty()) out << "    {0, 0, 0},\n";
+    out << "};\n\n";
+
+    out << "constexpr Step STEPS[] = {\n";
+    for (const auto& s : steps) out << "    {" << s.start << ", " << s.block << "},\n";
+    if (steps.empty()) out << "    {0, 0},\n";
+    out << "};\n\n";
+
+    out << "constexpr uint32_t STEP_COUNT = " << steps.size() << ";\n\n";
+    out << "} // namespace " << name << "\n";
+    return (bool)out;
+}
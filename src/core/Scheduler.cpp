@@ -1,25 +1,58 @@
 #include "../../include/core/Scheduler.h"
 #include "../../include/servers/PollingServer.h"
 #include "../../include/servers/DeferrableServer.h"
+#include "../../include/utils/ColumnarWriter.h"
+#include "../../include/utils/TracePyramid.h"
+#include "../../include/core/DispatchTable.h"
+#include "../../include/core/TableDispatcher.h"
+#include "../../include/utils/CounterRng.h"
 #include <iostream>
 #include <fstream>
 #include <algorithm>
 #include <cmath>
+#include <map>
+#include <cstdio>
+#include <cctype>
+#include <numeric>
+#include <climits>
 
-// --- CONFIGURATION (SCALED FOR 0.1 QUANTUM) ---
-// 1 Unit = 10 Ticks. 
-// Server Capacity 2.0 -> 20 ticks
-// Server Period 5.0 -> 50 ticks
-const int SERVER_CAPACITY = 20; 
-const int SERVER_PERIOD = 50;
-const int SERVER_TASK_ID = 999;
-const int SAFETY_LIMIT = 10000; // Increased limit for higher tick count
+namespace {
+
+// Outputs are written next to their final name and renamed into place, so a
+// reader (the UI, watch mode clients) never sees a half-written file
+void replaceFile(const std::string& tmp, const std::string& path) {
+#ifdef _WIN32
+    std::remove(path.c_str()); // rename() doesn't replace on Windows
+#endif
+    std::rename(tmp.c_str(), path.c_str());
+}
+
+// Heap order for pendingReleases: earliest arrival on top, then release order
+bool laterArrival(const Job* a, const Job* b) {
+    if (a->arrivalTime != b->arrivalTime) return a->arrivalTime > b->arrivalTime;
+    return a->jobId > b->jobId;
+}
+
+// Heap order for suspendedJobs: earliest return on top, then job order
+struct LaterResume {
+    template <typename S>
+    bool operator()(const S& a, const S& b) const {
+        if (a.resume != b.resume) return a.resume > b.resume;
+        return a.job->jobId > b.job->jobId;
+    }
+};
+
+} // namespace
 
 Scheduler::Scheduler(const std::vector<Task>& pTasks, const std::vector<Task>& aTasks, 
                      ISchedulingAlgorithm* algo, std::string policy) 
     : periodicTasks(pTasks), aperiodicTasks(aTasks), algorithm(algo), serverPolicy(policy), 
-      serverTaskDefinition(nullptr), serverAlgo(nullptr) {
-    
+      verbose(true), recordHistory(true), deadlineMissed(false), ticksSimulated(0),
+      jobCounter(1), hasPendingArrival(false), started(false), jitterMode(JitterMode::FirstDelayed), jitterSeed(1),
+      progressInterval(0), cancelFlag(nullptr), cancelled(false), serverTaskDefinition(nullptr), serverAlgo(nullptr) {
+
+    defaultArrivals.reset(new VectorArrivalStream(aperiodicTasks));
+    arrivals = defaultArrivals.get();
     hyperperiod = calculateHyperperiod();
 
     // Initialize Server Strategy
@@ -33,10 +66,20 @@ Scheduler::Scheduler(const std::vector<Task>& pTasks, const std::vector<Task>& a
         serverTaskDefinition = new Task(SERVER_TASK_ID, TaskType::Periodic, 0, SERVER_CAPACITY, SERVER_PERIOD, SERVER_PERIOD);
         periodicTasks.push_back(*serverTaskDefinition);
     }
+
+    for (const auto& task : periodicTasks) periodicIds.insert(task.id);
+}
+
+void Scheduler::setArrivalStream(ArrivalStream* stream) {
+    aperiodicTasks.clear();
+    arrivals = stream;
+    hyperperiod = calculateHyperperiod();
 }
 
 Scheduler::~Scheduler() {
     for (Job* j : readyQueue) delete j;
+    for (Job* j : pendingReleases) delete j;
+    for (const auto& s : suspendedJobs) delete s.job;
     for (Job* j : aperiodicQueue) delete j;
     if (serverTaskDefinition) delete serverTaskDefinition;
     if (serverAlgo) delete serverAlgo; 
@@ -74,177 +117,358 @@ int Scheduler::calculateHyperperiod() {
     }
 
     // 2. Aperiodic Extension
-    int maxArrival = 0;
+    long long maxArrival = 0;
+    long long limit = SAFETY_LIMIT;
     for (const auto& task : aperiodicTasks) {
         // Buffer scaled: 20 -> 200 ticks
         int neededTime = task.releaseTime + task.computationTime + 200;
         if (neededTime > maxArrival) maxArrival = neededTime;
     }
+    if (arrivals != defaultArrivals.get()) {
+        // Trace replay: cover the last release (its WCET isn't known yet)
+        limit = TRACE_LIMIT;
+        if (arrivals->lastRelease() >= 0) maxArrival = std::max(maxArrival, arrivals->lastRelease() + 200LL);
+    }
 
     if (h < maxArrival) {
-        long long extendedH = h;
-        while (extendedH < maxArrival && extendedH < SAFETY_LIMIT) {
-            extendedH += h;
-        }
-        h = extendedH;
+        // Whole hyperperiods up to the last arrival (or past the limit)
+        h = ((std::min(maxArrival, limit) + h - 1) / h) * h;
     }
     
-    if (h > SAFETY_LIMIT) h = SAFETY_LIMIT;
+    if (h > limit) h = limit;
 
     return (int)h;
 }
 
 void Scheduler::run() {
-    std::cout << "Starting Simulation. Hyperperiod (Ticks): " << hyperperiod << ", Policy: " << serverPolicy << std::endl;
-    int jobCounter = 1;
+    if (verbose) {
+        std::cout << "Starting Simulation. Hyperperiod (Ticks): " << hyperperiod << ", Policy: " << serverPolicy << std::endl;
+    }
+    begin();
 
-    for (int t = 0; t < hyperperiod; t++) {
-        
-        // --- 0. REPLENISHMENT / CLEANUP ---
-        // Remove old server jobs that have expired to prevent "False Deadline Misses"
-        auto it = readyQueue.begin();
-        while (it != readyQueue.end()) {
-            Job* j = *it;
-            if (j->task->id == SERVER_TASK_ID && j->absoluteDeadline <= t) {
-                delete j;
-                it = readyQueue.erase(it);
-            } else {
-                ++it;
-            }
+    for (int t = ticksSimulated; t < hyperperiod; t++) {
+
+        if (cancelFlag != nullptr && cancelFlag->load()) {
+            cancelled = true;
+            if (verbose) std::cout << "Simulation cancelled at tick " << t << std::endl;
+            break;
         }
 
-        // --- 1. PERIODIC ARRIVALS ---
-        for (const auto& task : periodicTasks) {
-            if (t >= task.releaseTime && (t - task.releaseTime) % task.period == 0) {
-                Job* newJob = new Job(jobCounter++, &task, t);
-                readyQueue.push_back(newJob);
-            }
+        if (progressCallback && t > 0 && t % progressInterval == 0) {
+            progressCallback({t, hyperperiod, history.size(), deadlineMissed ? 1 : 0});
+        }
+
+        if (!step(t)) return;
+    }
+
+    retireArrivals(ticksSimulated);
+    if (progressCallback) progressCallback({ticksSimulated, hyperperiod, history.size(), deadlineMissed ? 1 : 0});
+}
+
+bool Scheduler::advance(int until) {
+    begin();
+    for (int t = ticksSimulated; t < until && !deadlineMissed; t++) {
+        if (!step(t)) break;
+    }
+    retireArrivals(ticksSimulated);
+    return !deadlineMissed;
+}
+
+int Scheduler::releaseJob(int taskId, int t, int absoluteDeadline) {
+    auto it = std::find_if(periodicTasks.begin(), periodicTasks.end(), [taskId](const Task& task) {
+        return task.id == taskId && task.type == TaskType::Sporadic;
+    });
+    if (it == periodicTasks.end()) return -1;
+
+    Job* job = new Job(jobCounter++, &*it, std::max(t, ticksSimulated));
+    job->absoluteDeadline = absoluteDeadline;
+    pendingReleases.push_back(job);
+    std::push_heap(pendingReleases.begin(), pendingReleases.end(), laterArrival);
+    return job->jobId;
+}
+
+int Scheduler::earliestCompletion() const {
+    int earliest = INT_MAX;
+    for (const Job* job : readyQueue) {
+        if (job->task->id == SERVER_TASK_ID) continue;
+        earliest = std::min(earliest, ticksSimulated + job->remainingExecutionTime);
+    }
+    for (const Job* job : pendingReleases) {
+        earliest = std::min(earliest, job->arrivalTime + job->remainingExecutionTime);
+    }
+    for (const auto& s : suspendedJobs) earliest = std::min(earliest, s.resume + s.job->remainingExecutionTime);
+    return earliest;
+}
+
+int Scheduler::releaseDelay(const Task& task, long long k) const {
+    if (jitterMode == JitterMode::FirstDelayed) return k == 0 ? task.jitter : 0;
+    CounterRng rng(jitterSeed, ((uint64_t)(uint32_t)task.id << 32) | (uint64_t)(k & 0xFFFFFFFF));
+    return (int)rng.below((uint64_t)task.jitter + 1);
+}
+
+int Scheduler::suspensionAfter(const Job& job) const {
+    // Ends of the execution segments but the last, against the work done
+    const Task& task = *job.task;
+    int done = task.computationTime - job.remainingExecutionTime;
+    int end = 0;
+    for (int k = 0; k + 1 < task.segmentCount; k += 2) {
+        end += task.segments[k];
+        if (end == done) return task.segments[k + 1];
+        if (end > done) break;
+    }
+    return 0;
+}
+
+void Scheduler::begin() {
+    if (started) return;
+    started = true;
+    hasPendingArrival = arrivals->next(pendingArrival);
+}
+
+bool Scheduler::step(int t) {
+    // --- 0. REPLENISHMENT / CLEANUP ---
+    // Remove old server jobs that have expired to prevent "False Deadline Misses"
+    auto it = readyQueue.begin();
+    while (it != readyQueue.end()) {
+        Job* j = *it;
+        if (j->task->id == SERVER_TASK_ID && j->absoluteDeadline <= t) {
+            delete j;
+            it = readyQueue.erase(it);
+        } else {
+            ++it;
         }
+    }
 
-        // --- 2. APERIODIC ARRIVALS ---
-        for (const auto& task : aperiodicTasks) {
-            if (t == task.releaseTime) {
-                Job* newAJob = new Job(jobCounter++, &task, t);
-                aperiodicQueue.push_back(newAJob);
-                history.push_back({t, newAJob->jobId, task.id, "AperiodicArrival"});
+    // --- 1. PERIODIC ARRIVALS ---
+    for (const auto& task : periodicTasks) {
+        if (task.type == TaskType::Sporadic) continue; // Released through releaseJob()
+        if (t >= task.releaseTime && (t - task.releaseTime) % task.period == 0) {
+            Job* newJob = new Job(jobCounter++, &task, t);
+            int delay = task.jitter > 0 ? releaseDelay(task, (t - task.releaseTime) / task.period) : 0;
+            if (delay > 0) {
+                // Deadline stays with the nominal release
+                newJob->arrivalTime = t + delay;
+                pendingReleases.push_back(newJob);
+                std::push_heap(pendingReleases.begin(), pendingReleases.end(), laterArrival);
+                continue;
             }
+            readyQueue.push_back(newJob);
         }
+    }
 
-        // --- 3. SCHEDULING DECISION ---
-        algorithm->pickNextJob(readyQueue, t); 
-        
-        Job* currentJob = nullptr;
+    // Sporadic jobs handed in by releaseJob() and jittered jobs that are due
+    while (!pendingReleases.empty() && pendingReleases.front()->arrivalTime <= t) {
+        std::pop_heap(pendingReleases.begin(), pendingReleases.end(), laterArrival);
+        readyQueue.push_back(pendingReleases.back());
+        pendingReleases.pop_back();
+    }
+
+    // Self-suspended jobs whose suspension is over
+    while (!suspendedJobs.empty() && suspendedJobs.front().resume <= t) {
+        std::pop_heap(suspendedJobs.begin(), suspendedJobs.end(), LaterResume());
+        Job* job = suspendedJobs.back().job;
+        suspendedJobs.pop_back();
+        history.push_back({t, job->jobId, job->task->id, "Resume"});
+        readyQueue.push_back(job);
+    }
 
-        if (!readyQueue.empty()) {
-            Job* bestJob = readyQueue.front();
+    // --- 2. APERIODIC ARRIVALS ---
+    releaseArrivals(t, jobCounter, pendingArrival, hasPendingArrival);
+
+    // --- 3. SCHEDULING DECISION ---
+    algorithm->pickNextJob(readyQueue, t); 
+    
+    Job* currentJob = nullptr;
 
-            // SERVER LOGIC INTERCEPTION
-            if (bestJob->task->id == SERVER_TASK_ID && serverAlgo != nullptr) {
+    if (!readyQueue.empty()) {
+        Job* bestJob = readyQueue.front();
+
+        // SERVER LOGIC INTERCEPTION
+        if (bestJob->task->id == SERVER_TASK_ID && serverAlgo != nullptr) {
+            
+            bool hasWork = !aperiodicQueue.empty(); 
+            
+            if (hasWork) {
+                currentJob = bestJob;
                 
-                bool hasWork = !aperiodicQueue.empty(); 
+                // Delegate execution to Strategy (Poller/Deferrable)
+                serverAlgo->run(currentJob, aperiodicQueue, history, t);
                 
-                if (hasWork) {
-                    currentJob = bestJob;
-                    
-                    // Delegate execution to Strategy (Poller/Deferrable)
-                    serverAlgo->run(currentJob, aperiodicQueue, history, t);
-                    
-                    // CHECK: Did the server finish its budget just now?
-                    if (currentJob->remainingExecutionTime <= 0) {
-                        auto s_it = std::find(readyQueue.begin(), readyQueue.end(), currentJob);
-                        if (s_it != readyQueue.end()) {
-                            readyQueue.erase(s_it);
-                            delete currentJob;
-                        }
+                // CHECK: Did the server finish its budget just now?
+                if (currentJob->remainingExecutionTime <= 0) {
+                    auto s_it = std::find(readyQueue.begin(), readyQueue.end(), currentJob);
+                    if (s_it != readyQueue.end()) {
+                        readyQueue.erase(s_it);
+                        delete currentJob;
                     }
-                    // Server executed work, skip normal execution step
-                    goto end_of_tick; 
+                }
+                // Server executed work, skip normal execution step
+                goto end_of_tick; 
+            } 
+            else {
+                // SERVER YIELDS
+                if (serverPolicy == "Poller") {
+                    // Poller burns budget immediately
+                    auto p_it = std::find(readyQueue.begin(), readyQueue.end(), bestJob);
+                    if (p_it != readyQueue.end()) {
+                        readyQueue.erase(p_it);
+                        delete bestJob;
+                    }
+                    // Pick next best job
+                    if (!readyQueue.empty()) currentJob = readyQueue.front();
+                    else currentJob = nullptr;
                 } 
                 else {
-                    // SERVER YIELDS
-                    if (serverPolicy == "Poller") {
-                        // Poller burns budget immediately
-                        auto p_it = std::find(readyQueue.begin(), readyQueue.end(), bestJob);
-                        if (p_it != readyQueue.end()) {
-                            readyQueue.erase(p_it);
-                            delete bestJob;
-                        }
-                        // Pick next best job
-                        if (!readyQueue.empty()) currentJob = readyQueue.front();
-                        else currentJob = nullptr;
-                    } 
-                    else {
-                        // Deferrable preserves budget but skips turn
-                        // Pick 2nd best job (Task 1)
-                        if (readyQueue.size() > 1) {
-                            currentJob = readyQueue[1]; 
-                        } else {
-                            currentJob = nullptr;
-                        }
+                    // Deferrable preserves budget but skips turn
+                    // Pick 2nd best job (Task 1)
+                    if (readyQueue.size() > 1) {
+                        currentJob = readyQueue[1]; 
+                    } else {
+                        currentJob = nullptr;
                     }
                 }
-            } else {
-                currentJob = bestJob;
             }
+        } else {
+            currentJob = bestJob;
         }
+    }
 
-        // --- 4. NORMAL EXECUTION ---
-        if (currentJob != nullptr && currentJob->remainingExecutionTime > 0) {
+    // --- 4. NORMAL EXECUTION ---
+    if (currentJob != nullptr && currentJob->remainingExecutionTime > 0) {
+        
+        if (currentJob->startTime == -1) currentJob->startTime = t;
+        
+        history.push_back({t, currentJob->jobId, currentJob->task->id, "Running"});
+        currentJob->remainingExecutionTime--;
+
+        if (currentJob->remainingExecutionTime <= 0) {
+            currentJob->finishTime = t + 1;
+            history.push_back({t + 1, currentJob->jobId, currentJob->task->id, "Finish"});
+            if (completionCallback) completionCallback(*currentJob);
             
-            if (currentJob->startTime == -1) currentJob->startTime = t;
+            auto j_it = std::find(readyQueue.begin(), readyQueue.end(), currentJob);
+            if (j_it != readyQueue.end()) {
+                readyQueue.erase(j_it);
+                delete currentJob;
+            }
+        } else if (currentJob->task->segmentCount > 1) {
+            // End of an execution segment: the job leaves the ready queue
+            int suspension = suspensionAfter(*currentJob);
+            auto j_it = std::find(readyQueue.begin(), readyQueue.end(), currentJob);
+            if (suspension > 0 && j_it != readyQueue.end()) {
+                readyQueue.erase(j_it);
+                history.push_back({t + 1, currentJob->jobId, currentJob->task->id, "Suspend"});
+                suspendedJobs.push_back({t + 1 + suspension, currentJob});
+                std::push_heap(suspendedJobs.begin(), suspendedJobs.end(), LaterResume());
+            }
+        }
+    } else {
+        // --- 5. BACKGROUND EXECUTION ---
+        if (readyQueue.empty() && !aperiodicQueue.empty()) {
+            Job* aJob = aperiodicQueue.front();
+            history.push_back({t, aJob->jobId, aJob->task->id, "BackgroundRun"});
+            aJob->remainingExecutionTime--;
             
-            history.push_back({t, currentJob->jobId, currentJob->task->id, "Running"});
-            currentJob->remainingExecutionTime--;
-
-            if (currentJob->remainingExecutionTime <= 0) {
-                currentJob->finishTime = t + 1;
-                history.push_back({t + 1, currentJob->jobId, currentJob->task->id, "Finish"});
-                
-                auto j_it = std::find(readyQueue.begin(), readyQueue.end(), currentJob);
-                if (j_it != readyQueue.end()) {
-                    readyQueue.erase(j_it);
-                    delete currentJob;
-                }
+            if (aJob->remainingExecutionTime <= 0) {
+                delete aJob;
+                aperiodicQueue.pop_front();
             }
         } else {
-            // --- 5. BACKGROUND EXECUTION ---
-            if (readyQueue.empty() && !aperiodicQueue.empty()) {
-                Job* aJob = aperiodicQueue.front();
-                history.push_back({t, aJob->jobId, aJob->task->id, "BackgroundRun"});
-                aJob->remainingExecutionTime--;
-                
-                if (aJob->remainingExecutionTime <= 0) {
-                    delete aJob;
-                    aperiodicQueue.erase(aperiodicQueue.begin());
-                }
-            } else {
-                history.push_back({t, -1, -1, "Idle"});
-            }
+            history.push_back({t, -1, -1, "Idle"});
         }
+    }
 
-        end_of_tick:;
+    end_of_tick:;
+    ticksSimulated = t + 1;
+    if (!recordHistory) history.clear();
 
-        // --- 6. DEADLINE CHECK ---
+    if (serverAlgo != nullptr && recordHistory) {
+        int budget = 0;
         for (Job* job : readyQueue) {
-            // Ignore Server tasks for deadline checks
-            if (job->task->id == SERVER_TASK_ID) continue;
-
-            if (t + 1 > job->absoluteDeadline) {
-                std::cerr << "\n!!! DEADLINE MISS DETECTED !!!\n";
-                std::cerr << "Time (Tick): " << t + 1 << "\n";
-                std::cerr << "Job ID: " << job->jobId << " (Task " << job->task->id << ")\n";
-                history.push_back({t + 1, job->jobId, job->task->id, "DEADLINE_MISS"});
-                exportToFile("output_ABORTED.txt");
-                return;
-            }
+            if (job->task->id == SERVER_TASK_ID) { budget = job->remainingExecutionTime; break; }
         }
+        budgetTrace.push_back(budget);
     }
+
+    // --- 6. DEADLINE CHECK ---
+    const Job* missed = nullptr;
+    for (Job* job : readyQueue) {
+        // Ignore Server tasks for deadline checks
+        if (job->task->id == SERVER_TASK_ID) continue;
+
+        if (t + 1 > job->absoluteDeadline) {
+            missed = job;
+            break;
+        }
+    }
+    // A job can also miss while it is suspended
+    for (size_t k = 0; k < suspendedJobs.size() && !missed; k++) {
+        if (t + 1 > suspendedJobs[k].job->absoluteDeadline) missed = suspendedJobs[k].job;
+    }
+
+    if (missed) {
+        deadlineMissed = true;
+        history.push_back({t + 1, missed->jobId, missed->task->id, "DEADLINE_MISS"});
+        if (verbose) {
+            std::cerr << "\n!!! DEADLINE MISS DETECTED !!!\n";
+            std::cerr << "Time (Tick): " << t + 1 << "\n";
+            std::cerr << "Job ID: " << missed->jobId << " (Task " << missed->task->id << ")\n";
+            exportToFile("output_ABORTED.txt");
+        }
+        if (progressCallback) progressCallback({t + 1, hyperperiod, history.size(), 1});
+        return false;
+    }
+    return true;
+}
+
+void Scheduler::retireArrivals(int t) {
+    // Tasks in front of the oldest waiting job have all been served (FIFO).
+    // Called at every tick boundary, so they completed exactly at t.
+    while (!streamedTasks.empty() &&
+           (aperiodicQueue.empty() || aperiodicQueue.front()->task != &streamedTasks.front())) {
+        aperiodicResponses.push_back(t - streamedTasks.front().releaseTime);
+        streamedTasks.pop_front();
+    }
+}
+
+void Scheduler::releaseArrivals(int t, int& jobCounter, Task& pending, bool& hasPending) {
+    retireArrivals(t);
+
+    while (hasPending && pending.releaseTime <= t) {
+        streamedTasks.push_back(pending);
+        streamedTasks.back().releaseTime = t; // Actual arrival, for the response time
+        Job* newAJob = new Job(jobCounter++, &streamedTasks.back(), t);
+        aperiodicQueue.push_back(newAJob);
+        history.push_back({t, newAJob->jobId, pending.id, "AperiodicArrival"});
+        hasPending = arrivals->next(pending);
+    }
+}
+
+std::string Scheduler::describe(const TimelineEvent& event) const {
+    std::string desc = "Unknown";
+    
+    // Identify Description
+    if (event.type == "DEADLINE_MISS") {
+        desc = "FAILURE";
+    }
+    else if (event.type.find("ServerExec") != std::string::npos || event.taskId == SERVER_TASK_ID) {
+        desc = "Server(" + serverPolicy + ")";
+    } 
+    else if (periodicIds.count(event.taskId)) {
+        desc = "Periodic";
+    }
+    else if (event.taskId >= 0) {
+        // Anything else with a task is an aperiodic arrival (list or stream)
+        desc = "Aperiodic";
+    }
+    return desc;
 }
 
 void Scheduler::exportToFile(const std::string& filename) {
     std::string fullPath = "../../data/" + filename;   
+    std::string tmpPath = fullPath + ".tmp";
 
-    std::ofstream outFile(fullPath);
+    std::ofstream outFile(tmpPath);
     if (!outFile.is_open()) {
         std::cout << "Error opening file: " << fullPath << std::endl;
         return;
@@ -254,26 +478,7 @@ void Scheduler::exportToFile(const std::string& filename) {
     outFile << "--------------------------------------------------------\n";
 
     for (const auto& event : history) {
-        std::string desc = "Unknown";
-        
-        // Identify Description
-        if (event.type == "DEADLINE_MISS") {
-            desc = "FAILURE";
-        }
-        else if (event.type.find("ServerExec") != std::string::npos || event.taskId == SERVER_TASK_ID) {
-            desc = "Server(" + serverPolicy + ")";
-        } 
-        else {
-            bool found = false;
-            for (const auto& t : periodicTasks) {
-                if (t.id == event.taskId) { desc = "Periodic"; found = true; break; }
-            }
-            if (!found) {
-                for (const auto& t : aperiodicTasks) {
-                    if (t.id == event.taskId) { desc = "Aperiodic"; break; }
-                }
-            }
-        }
+        std::string desc = describe(event);
 
         // UNSCALE TIME: Convert ticks (int) back to user time (double)
         double userTime = (double)event.time / 10.0;
@@ -286,5 +491,157 @@ void Scheduler::exportToFile(const std::string& filename) {
     }
 
     outFile.close();
-    std::cout << "Results saved to " << fullPath << std::endl;
-}
\ No newline at end of file
+    replaceFile(tmpPath, fullPath);
+    if (verbose) std::cout << "Results saved to " << fullPath << std::endl;
+}
+
+void Scheduler::exportColumnar(const std::string& directory) {
+    // Same events as exportToFile(), as .npy columns in raw ticks.
+    // Event names are replaced by small codes listed in schema.tsv.
+    ColumnarWriter writer(directory);
+    if (!writer.isOpen()) return;
+
+    int timeCol = writer.addColumn("time", ColumnarWriter::Type::Int32);
+    int jobCol = writer.addColumn("job", ColumnarWriter::Type::Int32);
+    int taskCol = writer.addColumn("task", ColumnarWriter::Type::Int32);
+    int eventCol = writer.addColumn("event", ColumnarWriter::Type::UInt8);
+
+    std::map<std::string, int> codes;
+    for (const auto& event : history) {
+        auto it = codes.find(event.type);
+        if (it == codes.end()) it = codes.insert({event.type, (int)codes.size()}).first;
+
+        writer.append(timeCol, event.time);
+        writer.append(jobCol, event.jobId);
+        writer.append(taskCol, event.taskId);
+        writer.append(eventCol, it->second);
+    }
+
+    writer.addNote("ticks_per_unit", "10");
+    writer.addNote("server_policy", serverPolicy);
+    for (const auto& c : codes) writer.addNote("event." + std::to_string(c.second), c.first);
+    writer.close();
+
+    std::cout << "Columnar results saved to " << directory << std::endl;
+}
+
+void Scheduler::exportPyramid(const std::string& filename) {
+    std::string fullPath = "../../data/" + filename;
+
+    // Lanes follow the chart: one per task id that executes, labelled like
+    // output.txt (a task served by the server shows up as the server).
+    // A replayed trace can hold millions of arrivals, so there its jobs
+    // share two lanes: the server's and one for background runs (id 0).
+    bool sharedLanes = arrivals != defaultArrivals.get();
+    auto laneKey = [&](const TimelineEvent& event) {
+        if (!sharedLanes || periodicIds.count(event.taskId)) return event.taskId;
+        return event.type.find("ServerExec") != std::string::npos ? SERVER_TASK_ID : 0;
+    };
+
+    std::vector<TracePyramid::Lane> lanes;
+    std::map<int, int> laneOf;
+    for (const auto& event : history) {
+        bool exec = event.type == "Running" || event.type == "BackgroundRun" ||
+                    event.type.find("ServerExec") != std::string::npos;
+        if (!exec) continue;
+
+        int key = laneKey(event);
+        auto it = laneOf.find(key);
+        if (it == laneOf.end()) {
+            laneOf[key] = (int)lanes.size();
+            lanes.push_back({key, describe(event)});
+        } else if (event.type.find("ServerExec") != std::string::npos) {
+            lanes[it->second].name = describe(event);
+        }
+    }
+
+    TracePyramid pyramid(lanes, ticksSimulated);
+    for (const auto& event : history) {
+        if (event.type == "DEADLINE_MISS") { pyramid.addMiss(event.time); continue; }
+        auto it = laneOf.find(laneKey(event));
+        if (it == laneOf.end()) continue;
+        if (event.type == "Running" || event.type == "BackgroundRun" ||
+            event.type.find("ServerExec") != std::string::npos) {
+            pyramid.addBusyTick(it->second, event.time);
+        }
+    }
+    for (size_t t = 0; t < budgetTrace.size(); t++) pyramid.setBudget((int)t, budgetTrace[t]);
+
+    if (!pyramid.write(fullPath + ".tmp")) {
+        std::cout << "Error opening file: " << fullPath << std::endl;
+        return;
+    }
+    replaceFile(fullPath + ".tmp", fullPath);
+    if (verbose) std::cout << "Timeline summary saved to " << fullPath << std::endl;
+}
+
+bool Scheduler::exportDispatchTable(const std::string& name) {
+    if (deadlineMissed || cancelled || ticksSimulated < hyperperiod) {
+        std::cout << "Error: dispatch table needs a complete run without deadline misses" << std::endl;
+        return false;
+    }
+
+    // The table repeats the simulated stretch, which must line up with the periodic releases
+    long long periodicH = serverAlgo != nullptr ? SERVER_PERIOD : 1;
+    for (const auto& task : periodicTasks) {
+        if (task.period <= 0 || periodicH > SAFETY_LIMIT) continue;
+        periodicH = periodicH / std::gcd(periodicH, (long long)task.period) * task.period;
+    }
+    if (ticksSimulated % periodicH != 0) {
+        std::cout << "Error: simulated " << ticksSimulated << " ticks, not a multiple of the hyperperiod "
+                  << periodicH << std::endl;
+        return false;
+    }
+
+    // The next cycle has to start empty, the table has no slots for work
+    // carried over from this one (jobs released near the end past an offset)
+    size_t unfinished = pendingReleases.size() + suspendedJobs.size();
+    for (Job* job : readyQueue) {
+        if (job->task->id != SERVER_TASK_ID) unfinished++;
+    }
+    if (unfinished > 0) {
+        std::cout << "Error: " << unfinished << " periodic job(s) still unfinished at tick " << ticksSimulated
+                  << ", the simulated cycle does not repeat" << std::endl;
+        return false;
+    }
+
+    std::vector<int32_t> timeline(ticksSimulated, -1);
+    for (const auto& event : history) {
+        if (event.time >= ticksSimulated) continue;
+        if (event.type == "Running") timeline[event.time] = event.taskId;
+        else if (event.type.find("ServerExec") != std::string::npos) timeline[event.time] = SERVER_TASK_ID;
+    }
+
+    DispatchTable table = DispatchTable::compile(timeline, 10);
+
+    // Replay it once against the simulation before writing anything
+    TableDispatcher<DispatchTable::Slot, DispatchTable::Block, DispatchTable::Step> dispatcher(
+        table.slots.data(), table.blocks.data(), table.steps.data(), (uint32_t)table.steps.size(),
+        table.cycleLength, table.frameSize);
+    for (int t = 0; t < ticksSimulated; t++) {
+        if (dispatcher.taskAt(t) != timeline[t]) {
+            std::cout << "Error: dispatch table differs from the simulation at tick " << t << std::endl;
+            return false;
+        }
+    }
+
+    std::string fullPath = "../../data/" + name;
+    std::string ns = "rt_" + name;
+    for (char& c : ns) {
+        if (!std::isalnum((unsigned char)c)) c = '_';
+    }
+    if (!table.writeBinary(fullPath + ".bin.tmp") ||
+        !table.writeHeader(fullPath + ".h.tmp", ns, algorithm->getName() + " schedule, policy " + serverPolicy)) {
+        std::cout << "Error opening file: " << fullPath << ".bin" << std::endl;
+        return false;
+    }
+    replaceFile(fullPath + ".bin.tmp", fullPath + ".bin");
+    replaceFile(fullPath + ".h.tmp", fullPath + ".h");
+
+    if (verbose) {
+        std::cout << "Dispatch table saved to " << fullPath << ".bin/.h (" << table.steps.size() << " frames of "
+                  << table.frameSize << " ticks, " << table.blocks.size() << " distinct, " << table.slots.size()
+                  << " slots, " << table.encodedSize() << " bytes)" << std::endl;
+    }
+    return true;
+}
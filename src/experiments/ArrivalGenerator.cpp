@@ -0,0 +1,169 @@
+#include "../../include/experiments/ArrivalGenerator.h"
+#include <cmath>
+#include <algorithm>
+#include <string>
+
+namespace {
+
+const int SCALE_FACTOR = 10;
+const double MAX_EXEC_UNITS = 1e6; // Clamp for extreme heavy-tail draws
+
+} // namespace
+
+bool ArrivalGenerator::validate(const Config& config, std::string& error) {
+    if (config.arrivals == ArrivalModel::Poisson) {
+        if (!(config.rate > 0) || !std::isfinite(config.rate)) {
+            error = "the arrival rate must be positive";
+            return false;
+        }
+        return true;
+    }
+
+    if (config.stateRates.empty() || config.stateRates.size() != config.stateDwell.size()) {
+        error = "MMPP needs one rate and one dwell time per state";
+        return false;
+    }
+    bool arriving = false;
+    for (size_t k = 0; k < config.stateRates.size(); k++) {
+        if (!(config.stateRates[k] >= 0) || !std::isfinite(config.stateRates[k])) {
+            error = "MMPP rates must be zero or positive";
+            return false;
+        }
+        if (!(config.stateDwell[k] > 0) || !std::isfinite(config.stateDwell[k])) {
+            error = "MMPP dwell times must be positive";
+            return false;
+        }
+        if (config.stateRates[k] > 0) arriving = true;
+    }
+    // Without a state that produces arrivals nextArrival() would cycle forever
+    if (!arriving) {
+        error = "at least one MMPP rate must be positive";
+        return false;
+    }
+    return true;
+}
+
+ArrivalGenerator::ArrivalGenerator(const Config& config)
+    : config(config), usable(false), rng(config.seed, 0), emitted(0), time(0), state(0), stateEnd(0), last(-1) {
+    std::string error;
+    usable = validate(config, error);
+    if (!usable) return; // Produces no arrivals
+
+    // Dry run for the last release, then start over with the same stream
+    restart();
+    Task task;
+    while (next(task)) last = task.releaseTime;
+    restart();
+}
+
+void ArrivalGenerator::restart() {
+    rng = CounterRng(config.seed, 0);
+    emitted = 0;
+    time = 0;
+    state = 0;
+    stateEnd = config.arrivals == ArrivalModel::MMPP ? exponential(config.stateDwell[0]) : 0;
+}
+
+double ArrivalGenerator::exponential(double mean) {
+    return -mean * std::log(1.0 - rng.uniform());
+}
+
+double ArrivalGenerator::normal() {
+    // Box-Muller, one value per pair of draws (keeps the stream stateless)
+    double u1 = 1.0 - rng.uniform();
+    double u2 = rng.uniform();
+    return std::sqrt(-2.0 * std::log(u1)) * std::cos(6.283185307179586 * u2);
+}
+
+double ArrivalGenerator::execution() {
+    double mean = config.meanExec;
+    double x = mean;
+    switch (config.exec) {
+        case ExecModel::Pareto: {
+            double alpha = std::max(1.01, config.paretoShape);
+            double scale = mean * (alpha - 1.0) / alpha; // x_m giving the requested mean
+            x = scale / std::pow(1.0 - rng.uniform(), 1.0 / alpha);
+            break;
+        }
+        case ExecModel::LogNormal: {
+            double sigma = config.lognormalSigma;
+            double mu = std::log(mean) - sigma * sigma / 2.0;
+            x = std::exp(mu + sigma * normal());
+            break;
+        }
+        default:
+            x = exponential(mean);
+            break;
+    }
+    return std::min(x, MAX_EXEC_UNITS);
+}
+
+double ArrivalGenerator::nextArrival() {
+    if (config.arrivals == ArrivalModel::Poisson) {
+        time += exponential(1.0 / config.rate);
+        return time;
+    }
+
+    // MMPP: draw a gap at the current state's rate; if it runs past the end
+    // of the state, move to the boundary and draw again in the next state
+    // (memoryless, so this is exact)
+    while (true) {
+        double rate = config.stateRates[state];
+        double gap = rate > 0 ? exponential(1.0 / rate) : INFINITY;
+        if (time + gap <= stateEnd) {
+            time += gap;
+            return time;
+        }
+        time = stateEnd;
+        state = (state + 1) % config.stateRates.size();
+        stateEnd = time + exponential(config.stateDwell[state]);
+    }
+}
+
+bool ArrivalGenerator::next(Task& task) {
+    if (!usable || emitted >= config.count) return false;
+
+    double release = nextArrival();
+    int r = (int)std::min(2e9, std::round(release * SCALE_FACTOR));
+    int e = std::max(1, (int)std::round(execution() * SCALE_FACTOR));
+    int d = (int)std::round(config.relativeDeadline * SCALE_FACTOR);
+
+    task = Task(config.firstId + (int)(emitted % 1000000000), TaskType::Aperiodic, r, e, 0, d);
+    emitted++;
+    return true;
+}
+
+double ArrivalGenerator::meanRate() const {
+    if (config.arrivals == ArrivalModel::Poisson) return config.rate;
+    double arrivals = 0, span = 0;
+    for (size_t k = 0; k < config.stateRates.size(); k++) {
+        arrivals += config.stateRates[k] * config.stateDwell[k];
+        span += config.stateDwell[k];
+    }
+    return span > 0 ? arrivals / span : 0;
+}
+
+double ArrivalGenerator::offeredLoad() const {
+    return meanRate() * config.meanExec;
+}
+
+double ArrivalGenerator::execSecondMoment() const {
+    double mean = config.meanExec;
+    switch (config.exec) {
+        case ExecModel::Pareto: {
+            // E[min(X, M)^2] for X ~ Pareto(x_m, alpha), finite for any alpha
+            double alpha = std::max(1.01, config.paretoShape);
+            double scale = mean * (alpha - 1.0) / alpha;
+            double cap = std::max(scale, MAX_EXEC_UNITS);
+            double body = std::fabs(alpha - 2.0) < 1e-9
+                              ? 2.0 * scale * scale * std::log(cap / scale)
+                              : alpha * std::pow(scale, alpha) *
+                                    (std::pow(cap, 2.0 - alpha) - std::pow(scale, 2.0 - alpha)) / (2.0 - alpha);
+            return body + cap * cap * std::pow(scale / cap, alpha);
+        }
+        case ExecModel::LogNormal:
+            return mean * mean * std::exp(config.lognormalSigma * config.lognormalSigma);
+        default:
+            return 2.0 * mean * mean;
+    }
+}
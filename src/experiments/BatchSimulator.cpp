@@ -0,0 +1,245 @@
+#include "../../include/experiments/BatchSimulator.h"
+#include "../../include/core/Scheduler.h"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <thread>
+
+namespace {
+
+const int64_t NO_JOB = std::numeric_limits<int64_t>::max();
+const int32_t NEVER = std::numeric_limits<int32_t>::max();
+
+// Priority key layout: [primary:32][release time:28][task index:4]
+// Smaller key = higher priority. The (release, index) tail reproduces the
+// Scheduler's jobId tie-breaker, since job ids are handed out in that order.
+inline int64_t makeKey(int64_t primary, int64_t release, int64_t index) {
+    return (primary << 32) | (release << 4) | index;
+}
+
+// One engine instance per thread. All per-lane state is stored as
+// [task][lane] arrays so each step is a straight loop over lanes.
+template <int Lanes>
+class LaneEngine {
+public:
+    LaneEngine(BatchPolicy policy, const std::vector<TaskSet>& sets,
+               size_t begin, size_t end, std::vector<char>& results)
+        : policy(policy), sets(sets), next(begin), end(end), results(results) {
+        for (int l = 0; l < Lanes; l++) setIndex[l] = -1;
+    }
+
+    void run() {
+        for (int l = 0; l < Lanes; l++) refill(l);
+
+        while (activeLanes > 0) {
+            step();
+
+            for (int l = 0; l < Lanes; l++) {
+                if (setIndex[l] < 0) continue;
+                if (missed[l] || time[l] >= horizon[l]) {
+                    results[setIndex[l]] = missed[l] ? 0 : 1;
+                    refill(l);
+                }
+            }
+        }
+    }
+
+private:
+    BatchPolicy policy;
+    const std::vector<TaskSet>& sets;
+    size_t next;
+    size_t end;
+    std::vector<char>& results;
+    int activeLanes = 0;
+
+    // --- LANE STATE ---
+    int32_t remaining[BatchSimulator::MAX_TASKS][Lanes];
+    int32_t deadline[BatchSimulator::MAX_TASKS][Lanes];
+    int32_t released[BatchSimulator::MAX_TASKS][Lanes];
+
+    // Previous job of the task, kept for the tick in which it overlaps its
+    // successor (d == p). The Scheduler only flags a job after the tick at
+    // its deadline, so it may still finish there; any leftover is a miss.
+    int32_t carryRemaining[BatchSimulator::MAX_TASKS][Lanes];
+    int32_t carryDeadline[BatchSimulator::MAX_TASKS][Lanes];
+    int32_t carryReleased[BatchSimulator::MAX_TASKS][Lanes];
+    int32_t nextRelease[BatchSimulator::MAX_TASKS][Lanes];
+    int32_t wcet[BatchSimulator::MAX_TASKS][Lanes];
+    int32_t period[BatchSimulator::MAX_TASKS][Lanes];
+    int32_t relDeadline[BatchSimulator::MAX_TASKS][Lanes];
+    int32_t time[Lanes];
+    int32_t horizon[Lanes];
+    int32_t missed[Lanes];
+    int64_t setIndex[Lanes];
+
+    void refill(int l) {
+        if (setIndex[l] >= 0) activeLanes--;
+        setIndex[l] = -1;
+
+        // Empty sets are trivially schedulable, don't waste a lane on them.
+        // Sets that do not fit a lane are never simulated, so never accepted.
+        while (next < end && (sets[next].empty() || !BatchSimulator::fits(sets[next]))) {
+            results[next] = sets[next].empty() ? 1 : 0;
+            next++;
+        }
+
+        // Unused task slots are never released and never hold work
+        for (int k = 0; k < BatchSimulator::MAX_TASKS; k++) {
+            remaining[k][l] = 0;
+            deadline[k][l] = NEVER;
+            released[k][l] = 0;
+            carryRemaining[k][l] = 0;
+            carryDeadline[k][l] = NEVER;
+            carryReleased[k][l] = 0;
+            nextRelease[k][l] = NEVER;
+            wcet[k][l] = 0;
+            period[k][l] = 0;
+            relDeadline[k][l] = 0;
+        }
+        time[l] = 0;
+        horizon[l] = 0;
+        missed[l] = 0;
+
+        if (next >= end) return;
+
+        const TaskSet& set = sets[next];
+        setIndex[l] = (int64_t)next;
+        next++;
+
+        for (int k = 0; k < (int)set.size(); k++) {
+            nextRelease[k][l] = set[k].releaseTime;
+            wcet[k][l] = set[k].computationTime;
+            // One-shot tasks: push the next release past any possible horizon
+            period[k][l] = set[k].period > 0 ? set[k].period : SAFETY_LIMIT + 1;
+            relDeadline[k][l] = set[k].relativeDeadline;
+        }
+        horizon[l] = BatchSimulator::hyperperiodOf(set);
+        activeLanes++;
+    }
+
+    void step() {
+        // --- 1. RELEASES ---
+        for (int k = 0; k < BatchSimulator::MAX_TASKS; k++) {
+            for (int l = 0; l < Lanes; l++) {
+                bool rel = nextRelease[k][l] == time[l];
+                carryRemaining[k][l] = rel ? remaining[k][l] : 0;
+                carryDeadline[k][l] = rel ? deadline[k][l] : NEVER;
+                carryReleased[k][l] = rel ? released[k][l] : 0;
+                remaining[k][l] = rel ? wcet[k][l] : remaining[k][l];
+                deadline[k][l] = rel ? time[l] + relDeadline[k][l] : deadline[k][l];
+                released[k][l] = rel ? time[l] : released[k][l];
+                nextRelease[k][l] = rel ? nextRelease[k][l] + period[k][l] : nextRelease[k][l];
+            }
+        }
+
+        // --- 2. SELECTION (masked min over tasks) ---
+        // Slots 0..MAX_TASKS-1 are current jobs, MAX_TASKS.. are carried jobs
+        int64_t bestKey[Lanes];
+        int32_t bestSlot[Lanes];
+        for (int l = 0; l < Lanes; l++) {
+            bestKey[l] = NO_JOB;
+            bestSlot[l] = -1;
+        }
+
+        for (int k = 0; k < BatchSimulator::MAX_TASKS; k++) {
+            for (int l = 0; l < Lanes; l++) {
+                int64_t primary;
+                if (policy == BatchPolicy::RateMonotonic) primary = period[k][l];
+                else if (policy == BatchPolicy::DeadlineMonotonic) primary = relDeadline[k][l];
+                else primary = deadline[k][l];
+
+                int64_t key = makeKey(primary, released[k][l], k);
+                bool better = remaining[k][l] > 0 && key < bestKey[l];
+                bestKey[l] = better ? key : bestKey[l];
+                bestSlot[l] = better ? k : bestSlot[l];
+
+                int64_t carryPrimary = policy == BatchPolicy::EDF ? carryDeadline[k][l] : primary;
+                int64_t carryKey = makeKey(carryPrimary, carryReleased[k][l], k);
+                bool carryBetter = carryRemaining[k][l] > 0 && carryKey < bestKey[l];
+                bestKey[l] = carryBetter ? carryKey : bestKey[l];
+                bestSlot[l] = carryBetter ? BatchSimulator::MAX_TASKS + k : bestSlot[l];
+            }
+        }
+
+        // --- 3. EXECUTION ---
+        for (int k = 0; k < BatchSimulator::MAX_TASKS; k++) {
+            for (int l = 0; l < Lanes; l++) {
+                remaining[k][l] -= (bestSlot[l] == k) ? 1 : 0;
+                carryRemaining[k][l] -= (bestSlot[l] == BatchSimulator::MAX_TASKS + k) ? 1 : 0;
+            }
+        }
+
+        // --- 4. DEADLINE CHECK ---
+        for (int k = 0; k < BatchSimulator::MAX_TASKS; k++) {
+            for (int l = 0; l < Lanes; l++) {
+                bool miss = remaining[k][l] > 0 && time[l] + 1 > deadline[k][l];
+                bool carryMiss = carryRemaining[k][l] > 0 && time[l] + 1 > carryDeadline[k][l];
+                missed[l] |= (miss || carryMiss) ? 1 : 0;
+            }
+        }
+
+        for (int l = 0; l < Lanes; l++) time[l]++;
+    }
+};
+
+} // namespace
+
+BatchSimulator::BatchSimulator(BatchPolicy policy, int lanes)
+    : policy(policy), lanes(lanes <= 8 ? 8 : 16) {}
+
+int BatchSimulator::hyperperiodOf(const TaskSet& set) {
+    long long h = 1;
+    for (const auto& task : set) {
+        if (task.period <= 0) continue;
+        long long a = h, b = task.period;
+        while (b != 0) {
+            long long temp = b;
+            b = a % b;
+            a = temp;
+        }
+        h = (h / a) * task.period;
+        if (h > SAFETY_LIMIT) return SAFETY_LIMIT;
+    }
+    return (int)h;
+}
+
+void BatchSimulator::runRange(const std::vector<TaskSet>& sets, size_t begin, size_t end,
+                              std::vector<char>& flags) const {
+    if (lanes == 8) {
+        LaneEngine<8> engine(policy, sets, begin, end, flags);
+        engine.run();
+    } else {
+        LaneEngine<16> engine(policy, sets, begin, end, flags);
+        engine.run();
+    }
+}
+
+std::vector<bool> BatchSimulator::run(const std::vector<TaskSet>& sets) const {
+    return runParallel(sets, 1);
+}
+
+std::vector<bool> BatchSimulator::runParallel(const std::vector<TaskSet>& sets, int threads) const {
+    // std::vector<bool> packs bits, so workers write bytes and we copy back
+    std::vector<char> flags(sets.size(), 0);
+
+    if (threads <= 1 || sets.size() < (size_t)lanes * 2) {
+        runRange(sets, 0, sets.size(), flags);
+    } else {
+        std::vector<std::thread> workers;
+        size_t chunk = (sets.size() + threads - 1) / threads;
+
+        for (int w = 0; w < threads; w++) {
+            size_t begin = w * chunk;
+            size_t end = std::min(sets.size(), begin + chunk);
+            if (begin >= end) break;
+            workers.emplace_back([this, &sets, &flags, begin, end]() {
+                runRange(sets, begin, end, flags);
+            });
+        }
+        for (auto& w : workers) w.join();
+    }
+
+    std::vector<bool> results(sets.size(), false);
+    for (size_t i = 0; i < sets.size(); i++) results[i] = flags[i] != 0;
+    return results;
+}
@@ -0,0 +1,270 @@
+#include "../../include/experiments/DistributedSimulator.h"
+#include "../../include/utils/CounterRng.h"
+#include <algorithm>
+#include <unordered_map>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <numeric>
+#include <climits>
+
+namespace {
+
+// Release of the next step of a transaction instance on another node
+struct Message {
+    int arrival;
+    int transaction; // Index into system.transactions
+    long long instance;
+    int step;
+    int release;     // Of the transaction instance
+};
+
+bool deliveredFirst(const Message& a, const Message& b) {
+    if (a.arrival != b.arrival) return a.arrival < b.arrival;
+    if (a.transaction != b.transaction) return a.transaction < b.transaction;
+    if (a.instance != b.instance) return a.instance < b.instance;
+    return a.step < b.step;
+}
+
+// Reusable barrier for a fixed number of threads (std::barrier is C++20)
+class Barrier {
+public:
+    explicit Barrier(int parties) : parties(parties), arrived(0), generation(0) {}
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex);
+        long long current = generation;
+        if (++arrived == parties) {
+            arrived = 0;
+            generation++;
+            cv.notify_all();
+            return;
+        }
+        cv.wait(lock, [&] { return generation != current; });
+    }
+
+private:
+    std::mutex mutex;
+    std::condition_variable cv;
+    int parties;
+    int arrived;
+    long long generation;
+};
+
+} // namespace
+
+struct DistributedSimulator::NodeState {
+    struct Instance {
+        int transaction;
+        int step;
+        long long instance;
+        int release;
+        int deadline;
+    };
+
+    std::unique_ptr<ISchedulingAlgorithm> algorithm;
+    std::unique_ptr<Scheduler> scheduler;
+    std::unordered_map<int, Instance> jobs; // Released and not completed, by job id
+    std::vector<Message> outbox;            // Sent during the current window
+};
+
+DistributedSimulator::DistributedSimulator(const DistributedSystem& system, const Config& config)
+    : system(system), config(config) {
+    for (const auto& spec : system.nodes) {
+        auto node = std::make_unique<NodeState>();
+        node->algorithm.reset(createAlgorithm(spec.algorithm));
+        node->scheduler = std::make_unique<Scheduler>(system.nodeTasks(spec.id), std::vector<Task>(),
+                                                      node->algorithm.get(), "Background");
+        node->scheduler->setVerbose(false);
+        node->scheduler->setRecordHistory(config.recordHistory);
+        nodes.push_back(std::move(node));
+    }
+}
+
+DistributedSimulator::~DistributedSimulator() = default;
+
+Scheduler& DistributedSimulator::node(size_t i) { return *nodes[i]->scheduler; }
+
+DistributedSimulator::Result DistributedSimulator::run() {
+    Result result;
+    const auto& transactions = system.transactions;
+    result.transactions.resize(transactions.size());
+    for (size_t i = 0; i < transactions.size(); i++) {
+        result.transactions[i].steps.resize(transactions[i].steps.size());
+    }
+
+    std::unordered_map<int, size_t> nodeIndex;
+    for (size_t n = 0; n < system.nodes.size(); n++) nodeIndex[system.nodes[n].id] = n;
+
+    // --- HORIZON AND LOOKAHEAD ---
+    long long horizon = config.horizon;
+    int maxDeadline = 0;
+    if (horizon <= 0) {
+        horizon = 1;
+        for (const auto& tr : transactions) {
+            horizon = std::min<long long>(std::lcm(horizon, (long long)tr.period), SAFETY_LIMIT);
+        }
+    }
+    for (const auto& tr : transactions) maxDeadline = std::max(maxDeadline, tr.deadline);
+    int end = (int)horizon + maxDeadline; // Room for the last instances to finish (or miss)
+
+    int lookahead = end;
+    for (const auto& tr : transactions) {
+        for (size_t k = 1; k < tr.steps.size(); k++) {
+            if (tr.steps[k - 1].node != tr.steps[k].node) {
+                lookahead = std::min(lookahead, system.minLatency(tr.steps[k - 1].node, tr.steps[k].node));
+            }
+        }
+    }
+    result.lookahead = lookahead = std::max(1, lookahead);
+
+    // --- RELEASE / COMPLETION ---
+    auto releaseStep = [&](NodeState& node, const NodeState::Instance& in, int arrival) {
+        const Transaction& tr = transactions[in.transaction];
+        int jobId = node.scheduler->releaseJob(tr.steps[in.step].taskId, arrival, in.deadline);
+        node.jobs[jobId] = in;
+
+        StepStats& stats = result.transactions[in.transaction].steps[in.step];
+        int offset = arrival - in.release;
+        if (stats.minRelease < 0 || offset < stats.minRelease) stats.minRelease = offset;
+        stats.maxRelease = std::max(stats.maxRelease, offset);
+    };
+
+    // Runs on the thread of the node (writes only to stats of its own steps)
+    auto complete = [&](NodeState& node, const Job& job) {
+        auto it = node.jobs.find(job.jobId);
+        if (it == node.jobs.end()) return;
+        NodeState::Instance in = it->second;
+        node.jobs.erase(it);
+
+        const Transaction& tr = transactions[in.transaction];
+        TransactionStats& trStats = result.transactions[in.transaction];
+        int response = job.finishTime - in.release;
+        StepStats& stats = trStats.steps[in.step];
+        stats.jobs++;
+        stats.maxResponse = std::max(stats.maxResponse, response);
+
+        if (in.step + 1 == (int)tr.steps.size()) {
+            trStats.completed++;
+            trStats.sumResponse += response;
+            trStats.maxResponse = std::max(trStats.maxResponse, response);
+            return;
+        }
+
+        int from = tr.steps[in.step].node, to = tr.steps[in.step + 1].node;
+        int latency = system.minLatency(from, to);
+        int spread = system.maxLatency(from, to) - latency;
+        if (spread > 0) {
+            uint64_t key = ((uint64_t)in.instance * transactions.size() + in.transaction) << 16 | (uint64_t)in.step;
+            CounterRng rng(config.seed, key);
+            latency += (int)rng.below((uint64_t)spread + 1);
+        }
+
+        Message message{job.finishTime + latency, in.transaction, in.instance, in.step + 1, in.release};
+        if (from == to) {
+            releaseStep(node, {message.transaction, message.step, message.instance, message.release, in.deadline},
+                        message.arrival);
+        } else {
+            node.outbox.push_back(message);
+        }
+    };
+
+    for (auto& node : nodes) {
+        NodeState* state = node.get();
+        state->scheduler->setCompletionCallback([&complete, state](const Job& job) { complete(*state, job); });
+    }
+
+    // --- WINDOWS ---
+    // Windows are short and end at a barrier: more workers than cores only adds waiting
+    int cores = std::max(1, (int)std::thread::hardware_concurrency());
+    int workers = std::max(1, std::min({config.threads, (int)nodes.size(), cores}));
+    result.threads = workers;
+    Barrier barrier(workers);
+    bool stop = false;
+    int windowEnd = 0;
+    auto advance = [&](int worker) {
+        for (size_t n = worker; n < nodes.size(); n += workers) nodes[n]->scheduler->advance(windowEnd);
+    };
+    std::vector<std::thread> pool;
+    for (int w = 1; w < workers; w++) {
+        pool.emplace_back([&, w]() {
+            while (true) {
+                barrier.wait();
+                if (stop) return;
+                advance(w);
+                barrier.wait();
+            }
+        });
+    }
+
+    std::vector<long long> nextInstance(transactions.size(), 0);
+    std::vector<Message> inbox;
+    for (int start = 0; start < end; start = windowEnd) {
+        // Nothing sent before the earliest possible completion arrives
+        // before that plus the lookahead
+        long long earliest = INT_MAX;
+        for (const auto& node : nodes) earliest = std::min<long long>(earliest, node->scheduler->earliestCompletion());
+        for (size_t i = 0; i < transactions.size(); i++) {
+            long long release = nextInstance[i] * transactions[i].period;
+            if (release < horizon) earliest = std::min(earliest, release + transactions[i].steps[0].computationTime);
+        }
+        for (const auto& node : nodes) {
+            for (const auto& m : node->outbox) earliest = std::min<long long>(earliest, m.arrival + 1);
+        }
+        windowEnd = (int)std::min<long long>(std::max<long long>(earliest, start + 1) + lookahead, end);
+
+        // Transaction releases due in this window, then messages sent in the last one
+        for (size_t i = 0; i < transactions.size(); i++) {
+            const Transaction& tr = transactions[i];
+            NodeState& node = *nodes[nodeIndex[tr.steps[0].node]];
+            for (long long& k = nextInstance[i]; k * tr.period < std::min<long long>(windowEnd, horizon); k++) {
+                int release = (int)(k * tr.period);
+                releaseStep(node, {(int)i, 0, k, release, release + tr.deadline}, release);
+            }
+        }
+        inbox.clear();
+        for (auto& node : nodes) {
+            inbox.insert(inbox.end(), node->outbox.begin(), node->outbox.end());
+            node->outbox.clear();
+        }
+        std::sort(inbox.begin(), inbox.end(), deliveredFirst);
+        for (const auto& m : inbox) {
+            const Transaction& tr = transactions[m.transaction];
+            releaseStep(*nodes[nodeIndex[tr.steps[m.step].node]],
+                        {m.transaction, m.step, m.instance, m.release, m.release + tr.deadline}, m.arrival);
+        }
+        result.messages += (long long)inbox.size();
+
+        barrier.wait();
+        advance(0);
+        barrier.wait();
+        result.windows++;
+        result.ticks = windowEnd;
+
+        // A miss ends the run; report the earliest one
+        for (const auto& node : nodes) {
+            if (!node->scheduler->hasDeadlineMiss()) continue;
+            int time = node->scheduler->simulatedTicks();
+            if (result.deadlineMiss && time >= result.missTime) continue;
+            const NodeState::Instance* missed = nullptr;
+            for (const auto& [jobId, in] : node->jobs) {
+                if (!missed || in.deadline < missed->deadline ||
+                    (in.deadline == missed->deadline && in.transaction < missed->transaction)) {
+                    missed = &in;
+                }
+            }
+            result.deadlineMiss = true;
+            result.missTime = result.ticks = time;
+            if (missed) {
+                result.missTransaction = transactions[missed->transaction].id;
+                result.missInstance = missed->instance;
+            }
+        }
+        if (result.deadlineMiss) break;
+    }
+
+    stop = true;
+    barrier.wait();
+    for (auto& t : pool) t.join();
+    return result;
+}
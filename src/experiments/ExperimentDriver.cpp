@@ -0,0 +1,373 @@
+#include "../../include/experiments/ExperimentDriver.h"
+#include "../../include/analysis/SchedulabilityAnalysis.h"
+#include "../../include/core/Scheduler.h"
+#include "../../include/utils/ParallelFor.h"
+#include "../../include/experiments/ProcessSweepExecutor.h"
+#include "../../include/utils/ColumnarWriter.h"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <iomanip>
+#include <map>
+#include <cmath>
+
+ExperimentDriver::ExperimentDriver(const Config& config) : config(config) {
+    const AlgorithmKind algorithms[] = {
+        AlgorithmKind::RateMonotonic, AlgorithmKind::DeadlineMonotonic,
+        AlgorithmKind::EDF, AlgorithmKind::LeastSlackTime
+    };
+    const char* policies[] = {"Background", "Poller", "Deferrable"};
+
+    for (const char* policy : policies) {
+        for (AlgorithmKind kind : algorithms) {
+            columns.push_back({kind, policy, shortName(kind) + "/" + policy});
+        }
+    }
+}
+
+std::string ExperimentDriver::bucketLabel(double utilization) {
+    std::ostringstream ss;
+    ss << std::fixed << std::setprecision(3) << utilization;
+    return ss.str();
+}
+
+std::string ExperimentDriver::configLine() const {
+    std::ostringstream ss;
+    ss << "# config " << std::hex << std::setw(16) << std::setfill('0') << signature();
+    return ss.str();
+}
+
+std::set<std::string> ExperimentDriver::completedBuckets(bool& sameConfig) const {
+    std::set<std::string> done;
+    std::ifstream in(config.outputPath);
+    std::string line;
+    std::string written;
+    while (std::getline(in, line)) {
+        if (line.compare(0, 9, "# config ") == 0) written = line;
+        if (line.compare(0, 7, "# skip ") == 0) {
+            std::istringstream skipped(line.substr(7));
+            std::string label;
+            int count = 0;
+            if (skipped >> label >> count) done.insert(label);
+            continue;
+        }
+        if (line.empty() || line[0] == '#' || line.compare(0, 11, "Utilization") == 0) continue;
+        // Only rows that were fully written (one value per column) count
+        size_t fields = std::count(line.begin(), line.end(), '\t');
+        if (fields != columns.size()) continue;
+        done.insert(line.substr(0, line.find('\t')));
+    }
+    // Rows from another mode, seed or generator setup must not be skipped
+    sameConfig = done.empty() || written == configLine();
+    return done;
+}
+
+uint64_t ExperimentDriver::signature() const {
+    // FNV-1a over everything that changes which sets are generated or how
+    // they are judged; a checkpoint from another configuration is ignored
+    std::ostringstream ss;
+    ss << (int)config.mode << ' ' << config.minUtilization << ' ' << config.maxUtilization << ' '
+       << config.utilizationStep << ' ' << config.setsPerBucket << ' ' << config.seed << ' '
+       << config.generator.taskCount << ' ' << config.generator.minDeadlineRatio << ' '
+       << config.generator.maxTaskUtilization;
+    for (int p : config.generator.periods) ss << ' ' << p;
+
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (char c : ss.str()) {
+        h ^= (uint8_t)c;
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
+TaskSet ExperimentDriver::generateItem(size_t item, double utilization) const {
+    CounterRng rng(config.seed, item);
+    return TaskSetGenerator(config.generator).generate(utilization, rng);
+}
+
+bool ExperimentDriver::simulate(const TaskSet& set, const Column& column) const {
+    // Keep the server backlogged for the whole run: one aperiodic job that
+    // never finishes, so the server behaves as its worst-case periodic task.
+    std::vector<Task> aperiodic;
+    if (column.serverPolicy != "Background") {
+        int horizon = BatchSimulator::hyperperiodOf(set);
+        aperiodic.push_back(Task((int)set.size() + 1, TaskType::Aperiodic, 0, horizon, 0, 0));
+    }
+
+    ISchedulingAlgorithm* algo = createAlgorithm(column.algorithm);
+    Scheduler scheduler(set, aperiodic, algo, column.serverPolicy);
+    scheduler.setVerbose(false);
+    scheduler.run();
+    bool ok = !scheduler.hasDeadlineMiss();
+    delete algo;
+    return ok;
+}
+
+bool ExperimentDriver::evaluateSet(const TaskSet& set, const Column& column) const {
+    if (config.mode == Mode::Analysis) {
+        return SchedulabilityAnalysis::isSchedulable(set, column.algorithm, column.serverPolicy);
+    }
+    return simulate(set, column);
+}
+
+std::vector<uint32_t> ExperimentDriver::evaluateSets(const std::vector<TaskSet>& sets) const {
+    if (config.isolate) return evaluateIsolated(sets);
+
+    std::vector<uint32_t> bits(sets.size(), 0);
+    for (size_t k = 0; k < columns.size(); k++) acceptColumn(sets, k, bits);
+    return bits;
+}
+
+std::vector<uint32_t> ExperimentDriver::evaluateIsolated(const std::vector<TaskSet>& sets) const {
+    ProcessSweepExecutor executor(config.threads, config.itemTimeoutSeconds);
+    auto records = executor.run(sets.size(), [&](size_t i) {
+        uint32_t bits = 0;
+        for (size_t k = 0; k < columns.size(); k++) {
+            if (evaluateSet(sets[i], columns[k])) bits |= 1u << k;
+        }
+        return bits;
+    });
+
+    // Crashed or timed-out sets count as rejected everywhere
+    std::vector<uint32_t> bits(sets.size(), 0);
+    int failed = 0;
+    for (size_t i = 0; i < records.size(); i++) {
+        if (records[i].status == ProcessSweepExecutor::Done) bits[i] = records[i].bits;
+        else failed++;
+    }
+    if (failed > 0) {
+        std::cout << "  " << failed << " sets crashed or timed out (counted as rejected), "
+                  << executor.restarts() << " worker restarts" << std::endl;
+    }
+    return bits;
+}
+
+void ExperimentDriver::acceptColumn(const std::vector<TaskSet>& sets, size_t k,
+                                    std::vector<uint32_t>& bits) const {
+    const Column& column = columns[k];
+    std::vector<char> accepted(sets.size(), 0);
+    std::vector<size_t> rest;
+
+    if (config.mode == Mode::Simulation && column.serverPolicy == "Background" &&
+        column.algorithm != AlgorithmKind::LeastSlackTime) {
+        // Plain periodic sets under RM/DM/EDF go through the lane engine,
+        // sets too large for a lane through the Scheduler below
+        std::vector<TaskSet> lane;
+        std::vector<size_t> laneIndex;
+        for (size_t i = 0; i < sets.size(); i++) {
+            if (BatchSimulator::fits(sets[i])) {
+                lane.push_back(sets[i]);
+                laneIndex.push_back(i);
+            }
+            else rest.push_back(i);
+        }
+        BatchPolicy policy = column.algorithm == AlgorithmKind::RateMonotonic ? BatchPolicy::RateMonotonic
+                           : column.algorithm == AlgorithmKind::DeadlineMonotonic ? BatchPolicy::DeadlineMonotonic
+                           : BatchPolicy::EDF;
+        std::vector<bool> ok = BatchSimulator(policy).runParallel(lane, config.threads);
+        for (size_t j = 0; j < lane.size(); j++) accepted[laneIndex[j]] = ok[j];
+    }
+    else {
+        for (size_t i = 0; i < sets.size(); i++) rest.push_back(i);
+    }
+
+    parallelFor(rest.size(), config.threads, [&](size_t j) {
+        accepted[rest[j]] = evaluateSet(sets[rest[j]], column);
+    });
+
+    for (size_t i = 0; i < sets.size(); i++) {
+        if (accepted[i]) bits[i] |= 1u << k;
+    }
+}
+
+void ExperimentDriver::run() {
+    bool sameConfig = true;
+    std::set<std::string> done = completedBuckets(sameConfig);
+    if (!sameConfig) {
+        std::cout << "Error: " << config.outputPath << " was written with a different configuration "
+                  << "(mode, seed, sets or generator); remove it or choose another output file." << std::endl;
+        return;
+    }
+    bool fresh = done.empty();
+
+    // A crash can leave a half-written row without its newline
+    bool needsNewline = false;
+    if (!fresh) {
+        std::ifstream check(config.outputPath, std::ios::binary | std::ios::ate);
+        if (check.tellg() > 0) {
+            check.seekg(-1, std::ios::end);
+            needsNewline = check.get() != '\n';
+        }
+    }
+
+    std::ofstream out(config.outputPath, fresh ? std::ios::trunc : std::ios::app);
+    if (!out.is_open()) {
+        std::cout << "Error opening file: " << config.outputPath << std::endl;
+        return;
+    }
+
+    if (fresh) {
+        out << configLine() << "\n";
+        out << "Utilization";
+        for (const auto& c : columns) out << "\t" << c.name;
+        out << "\n";
+        out.flush();
+    } else {
+        if (needsNewline) out << "\n";
+        std::cout << "Resuming: " << done.size() << " buckets already in " << config.outputPath << std::endl;
+    }
+
+    int buckets = (int)std::floor((config.maxUtilization - config.minUtilization) / config.utilizationStep + 1e-9) + 1;
+    size_t perBucket = (size_t)std::max(0, config.setsPerBucket);
+
+    SweepCheckpoint checkpoint(config.outputPath + ".ckpt", signature(), buckets * perBucket);
+    if (checkpoint.load()) {
+        std::cout << "Checkpoint: " << checkpoint.completedCount() << " sets already evaluated" << std::endl;
+    }
+
+    // Chunks bound the work lost on interruption and keep every core busy
+    size_t chunk = (size_t)std::max(256, config.threads * 64);
+
+    for (int b = 0; b < buckets; b++) {
+        double u = config.minUtilization + b * config.utilizationStep;
+        std::string label = bucketLabel(u);
+        if (done.count(label)) continue;
+
+        size_t first = b * perBucket;
+        std::vector<size_t> pending;
+        for (size_t item = first; item < first + perBucket; item++) {
+            if (!checkpoint.isDone(item)) pending.push_back(item);
+        }
+
+        for (size_t c = 0; c < pending.size(); c += chunk) {
+            size_t count = std::min(chunk, pending.size() - c);
+            std::vector<TaskSet> sets(count);
+            parallelFor(count, config.threads, [&](size_t i) {
+                sets[i] = generateItem(pending[c + i], u);
+            });
+
+            std::vector<uint32_t> bits = evaluateSets(sets);
+            for (size_t i = 0; i < count; i++) {
+                // An empty set only comes from a failed draw and would pass everywhere
+                checkpoint.markDone(pending[c + i], sets[i].empty() ? NOT_DRAWN : bits[i]);
+            }
+            checkpoint.saveIfDue(config.checkpointSeconds);
+        }
+
+        size_t notDrawn = 0;
+        std::vector<size_t> accepted(columns.size(), 0);
+        for (size_t item = first; item < first + perBucket; item++) {
+            if (checkpoint.bits(item) == NOT_DRAWN) notDrawn++;
+            for (size_t k = 0; k < columns.size(); k++) {
+                if (checkpoint.bits(item) & (1u << k)) accepted[k]++;
+            }
+        }
+
+        // The sets that could be drawn are a biased sample, so no ratio at all
+        if (notDrawn > 0) {
+            out << "# skip " << label << " " << notDrawn << "\n";
+            out.flush();
+            checkpoint.save();
+            std::cout << "U = " << label << " skipped (" << notDrawn << " of " << perBucket
+                      << " sets could not be drawn)" << std::endl;
+            continue;
+        }
+
+        std::ostringstream row;
+        row << label;
+        for (size_t k = 0; k < columns.size(); k++) {
+            double ratio = perBucket > 0 ? (double)accepted[k] / perBucket : 0.0;
+            row << "\t" << std::fixed << std::setprecision(4) << ratio;
+        }
+        out << row.str() << "\n";
+        out.flush();
+        checkpoint.save();
+
+        std::cout << "U = " << label << " done (" << perBucket << " sets)" << std::endl;
+    }
+    out.close();
+
+    if (!config.columnarDir.empty()) writeColumnar(checkpoint, buckets);
+
+    // Every bucket is in the curve file now, item progress is no longer needed
+    checkpoint.remove();
+
+    writeWeightedSchedulability();
+}
+
+void ExperimentDriver::writeWeightedSchedulability() const {
+    // W = sum(U * ratio(U)) / sum(U) over all buckets in the curve file
+    std::map<std::string, double> weighted;
+    double totalU = 0.0;
+
+    std::ifstream in(config.outputPath);
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.empty() || line.compare(0, 11, "Utilization") == 0) continue;
+        if ((size_t)std::count(line.begin(), line.end(), '\t') != columns.size()) continue;
+        std::stringstream ss(line);
+        double u;
+        if (!(ss >> u)) continue;
+        totalU += u;
+        for (const auto& c : columns) {
+            double r = 0.0;
+            ss >> r;
+            weighted[c.name] += u * r;
+        }
+    }
+
+    std::string path = config.outputPath;
+    size_t dot = path.find_last_of('.');
+    size_t slash = path.find_last_of("/\\");
+    if (dot != std::string::npos && (slash == std::string::npos || dot > slash)) path = path.substr(0, dot);
+    path += "_weighted.tsv";
+
+    std::ofstream out(path);
+    out << "Configuration\tWeightedSchedulability\n";
+    for (const auto& c : columns) {
+        double w = totalU > 0 ? weighted[c.name] / totalU : 0.0;
+        out << c.name << "\t" << std::fixed << std::setprecision(4) << w << "\n";
+    }
+    std::cout << "Results saved to " << config.outputPath << " and " << path << std::endl;
+}
+
+void ExperimentDriver::writeColumnar(const SweepCheckpoint& checkpoint, int buckets) const {
+    // One row per evaluated set. Sets finished by an earlier run are only
+    // present if that run's checkpoint was still around.
+    ColumnarWriter writer(config.columnarDir);
+    if (!writer.isOpen()) return;
+
+    int itemCol = writer.addColumn("item", ColumnarWriter::Type::Int64);
+    int bucketCol = writer.addColumn("bucket_utilization", ColumnarWriter::Type::Float64);
+    int utilCol = writer.addColumn("utilization", ColumnarWriter::Type::Float64);
+    std::vector<int> acceptCols;
+    for (const auto& c : columns) {
+        std::string name = c.name;
+        std::replace(name.begin(), name.end(), '/', '_');
+        acceptCols.push_back(writer.addColumn(name, ColumnarWriter::Type::UInt8));
+    }
+    writer.addNote("seed", std::to_string(config.seed));
+    writer.addNote("mode", config.mode == Mode::Simulation ? "simulation" : "analysis");
+
+    size_t perBucket = (size_t)std::max(0, config.setsPerBucket);
+    size_t rows = 0;
+    for (int b = 0; b < buckets; b++) {
+        double u = config.minUtilization + b * config.utilizationStep;
+        for (size_t item = b * perBucket; item < (b + 1) * perBucket; item++) {
+            if (!checkpoint.isDone(item) || checkpoint.bits(item) == NOT_DRAWN) continue;
+
+            // Regenerating the set is cheap and gives the post-rounding utilization
+            TaskSet set = generateItem(item, u);
+            writer.append(itemCol, (double)item);
+            writer.append(bucketCol, u);
+            writer.append(utilCol, SchedulabilityAnalysis::utilization(set));
+            for (size_t k = 0; k < columns.size(); k++) {
+                writer.append(acceptCols[k], (checkpoint.bits(item) >> k) & 1u);
+            }
+            rows++;
+        }
+    }
+    writer.close();
+    std::cout << "Columnar results (" << rows << " sets) saved to " << config.columnarDir << std::endl;
+}
@@ -0,0 +1,338 @@
+#include "../../include/experiments/MultiprocessorSimulator.h"
+#include "../../include/experiments/BatchSimulator.h"
+#include <algorithm>
+#include <cmath>
+#include <climits>
+
+namespace {
+
+const double EPS = 1e-9;
+const double DONE = 1e-6; // Remaining execution that counts as finished (fluid rounding)
+
+// The current job of a task (deadlines are at most the period: one at a time)
+struct JobState {
+    long long seq = 0;  // Jobs released so far
+    bool pending = false;
+    double release = 0;
+    double deadline = 0;
+    double remaining = 0;
+};
+
+// Who runs where, and what each change of the assignment costs
+class Dispatch {
+public:
+    Dispatch(int processors, size_t tasks)
+        : running(processors, -1), runningSeq(processors, 0), lastCpu(tasks, -1), lastSeq(tasks, 0) {}
+
+    bool isRunning(int task, long long seq) const {
+        for (size_t p = 0; p < running.size(); p++) {
+            if (running[p] == task && runningSeq[p] == seq) return true;
+        }
+        return false;
+    }
+
+    // Run `selected` (at most one task per processor) from now on
+    void assign(const std::vector<int>& selected, const std::vector<JobState>& jobs,
+                MultiprocessorSimulator::Result& result) {
+        std::vector<int> next(running.size(), -1);
+        std::vector<bool> placed(selected.size(), false);
+
+        // Chosen again: stay on the same processor
+        for (size_t k = 0; k < selected.size(); k++) {
+            int task = selected[k];
+            for (size_t p = 0; p < running.size(); p++) {
+                if (running[p] == task && runningSeq[p] == jobs[task].seq) {
+                    next[p] = task;
+                    placed[k] = true;
+                    break;
+                }
+            }
+        }
+        // Otherwise back to the last processor of the job if it is free, else the first free one
+        for (size_t k = 0; k < selected.size(); k++) {
+            if (placed[k]) continue;
+            int task = selected[k];
+            int p = lastSeq[task] == jobs[task].seq ? lastCpu[task] : -1;
+            if (p < 0 || next[p] >= 0) p = (int)(std::find(next.begin(), next.end(), -1) - next.begin());
+            next[p] = task;
+        }
+
+        for (size_t p = 0; p < running.size(); p++) {
+            int old = running[p], task = next[p];
+            bool same = task >= 0 && old == task && runningSeq[p] == jobs[task].seq;
+            if (same) continue;
+            if (old >= 0 && jobs[old].pending && jobs[old].seq == runningSeq[p]) result.preemptions++;
+            running[p] = task;
+            if (task < 0) continue;
+            result.contextSwitches++;
+            if (lastSeq[task] == jobs[task].seq && lastCpu[task] >= 0 && lastCpu[task] != (int)p) {
+                result.migrations++;
+            }
+            runningSeq[p] = jobs[task].seq;
+            lastCpu[task] = (int)p;
+            lastSeq[task] = jobs[task].seq;
+        }
+    }
+
+private:
+    std::vector<int> running;           // Task index per processor, -1 = idle
+    std::vector<long long> runningSeq;  // Job of that task
+    std::vector<int> lastCpu;
+    std::vector<long long> lastSeq;
+};
+
+// PD^2 subtask windows of one job, relative to its release (index i = subtask i + 1)
+struct SubtaskTable {
+    std::vector<int> release;
+    std::vector<int> deadline;
+    std::vector<char> successor;     // b-bit: the next window overlaps this one
+    std::vector<int> groupDeadline;  // Heavy tasks (C/D >= 1/2) only, 0 otherwise
+
+    SubtaskTable(int c, int d) : release(c), deadline(c), successor(c), groupDeadline(c, 0) {
+        for (long long i = 1; i <= c; i++) {
+            release[i - 1] = (int)((i - 1) * d / c);
+            deadline[i - 1] = (int)((i * d + c - 1) / c);
+            successor[i - 1] = (i * d) % c != 0;
+        }
+        if (2LL * c < d) return;
+        // Group deadline: the earliest time >= d(i) that ends a window with
+        // b = 0, or is one before the end of a window of length 3
+        int later = INT_MAX;
+        for (int i = c - 1; i >= 0; i--) {
+            int own = successor[i] ? INT_MAX : deadline[i];
+            groupDeadline[i] = std::min(own, later);
+            int length = deadline[i] - release[i];
+            later = std::min({later, own, length == 3 ? deadline[i] - 1 : INT_MAX});
+        }
+    }
+};
+
+void recordMiss(MultiprocessorSimulator::Result& result, const Task& task, double deadline) {
+    result.deadlineMiss = true;
+    result.missTask = task.id;
+    result.missTime = deadline;
+}
+
+} // namespace
+
+MultiprocessorSimulator::MultiprocessorSimulator(const std::vector<Task>& tasks, int processors)
+    : processors(std::max(1, processors)) {
+    for (const auto& t : tasks) {
+        if (t.period > 0 && t.computationTime > 0) this->tasks.push_back(t);
+    }
+}
+
+int MultiprocessorSimulator::deadlineOf(const Task& task) const {
+    int d = task.relativeDeadline > 0 ? task.relativeDeadline : task.period;
+    return std::min(d, task.period);
+}
+
+double MultiprocessorSimulator::density() const {
+    double total = 0;
+    for (const auto& t : tasks) total += (double)t.computationTime / deadlineOf(t);
+    return total;
+}
+
+const char* MultiprocessorSimulator::name(GlobalPolicy policy) {
+    switch (policy) {
+        case GlobalPolicy::EDF: return "GEDF";
+        case GlobalPolicy::PD2: return "PD2";
+        case GlobalPolicy::LLREF: return "LLREF";
+    }
+    return "?";
+}
+
+bool MultiprocessorSimulator::parsePolicy(const std::string& text, GlobalPolicy& policy) {
+    if (text == "gedf" || text == "edf") policy = GlobalPolicy::EDF;
+    else if (text == "pd2" || text == "pfair") policy = GlobalPolicy::PD2;
+    else if (text == "llref" || text == "dpfair") policy = GlobalPolicy::LLREF;
+    else return false;
+    return true;
+}
+
+MultiprocessorSimulator::Result MultiprocessorSimulator::run(GlobalPolicy policy, int horizon) const {
+    if (horizon <= 0) horizon = BatchSimulator::hyperperiodOf(tasks);
+    return policy == GlobalPolicy::LLREF ? runFluid(horizon) : runQuantum(policy, horizon);
+}
+
+// --- GLOBAL EDF / PD^2 (ticks) ---
+MultiprocessorSimulator::Result MultiprocessorSimulator::runQuantum(GlobalPolicy policy, int horizon) const {
+    Result result;
+    std::vector<JobState> jobs(tasks.size());
+    Dispatch dispatch(processors, tasks.size());
+
+    std::vector<SubtaskTable> subtasks;
+    if (policy == GlobalPolicy::PD2) {
+        for (const auto& t : tasks) subtasks.emplace_back(t.computationTime, deadlineOf(t));
+    }
+    // Index of the next subtask of a pending job
+    auto next = [&](size_t i) { return tasks[i].computationTime - (int)std::lround(jobs[i].remaining); };
+
+    auto pd2First = [&](int a, int b) {
+        const SubtaskTable& ta = subtasks[a];
+        const SubtaskTable& tb = subtasks[b];
+        int ka = next(a), kb = next(b);
+        double da = jobs[a].release + ta.deadline[ka], db = jobs[b].release + tb.deadline[kb];
+        if (da != db) return da < db;
+        if (ta.successor[ka] != tb.successor[kb]) return ta.successor[ka] > tb.successor[kb];
+        double ga = ta.groupDeadline[ka] ? jobs[a].release + ta.groupDeadline[ka] : 0;
+        double gb = tb.groupDeadline[kb] ? jobs[b].release + tb.groupDeadline[kb] : 0;
+        if (ga != gb) return ga > gb;
+        return a < b;
+    };
+    auto edfFirst = [&](int a, int b) {
+        if (jobs[a].deadline != jobs[b].deadline) return jobs[a].deadline < jobs[b].deadline;
+        return a < b;
+    };
+
+    std::vector<int> ready;
+    for (int t = 0; t <= horizon; t++) {
+        // Deadlines due now, then releases
+        for (size_t i = 0; i < tasks.size(); i++) {
+            if (jobs[i].pending && jobs[i].deadline <= t) {
+                recordMiss(result, tasks[i], jobs[i].deadline);
+                result.ticks = t;
+                return result;
+            }
+        }
+        if (t == horizon) break;
+        for (size_t i = 0; i < tasks.size(); i++) {
+            const Task& task = tasks[i];
+            if (t < task.releaseTime || (t - task.releaseTime) % task.period != 0) continue;
+            JobState& job = jobs[i];
+            job.seq++;
+            job.pending = true;
+            job.release = t;
+            job.deadline = t + deadlineOf(task);
+            job.remaining = task.computationTime;
+        }
+
+        ready.clear();
+        for (size_t i = 0; i < tasks.size(); i++) {
+            if (!jobs[i].pending) continue;
+            // PD^2: a subtask waits for its window
+            if (policy == GlobalPolicy::PD2 && jobs[i].release + subtasks[i].release[next(i)] > t) continue;
+            ready.push_back((int)i);
+        }
+        size_t count = std::min(ready.size(), (size_t)processors);
+        if (policy == GlobalPolicy::PD2) {
+            std::partial_sort(ready.begin(), ready.begin() + count, ready.end(), pd2First);
+        } else {
+            std::partial_sort(ready.begin(), ready.begin() + count, ready.end(), edfFirst);
+        }
+        ready.resize(count);
+        dispatch.assign(ready, jobs, result);
+
+        for (int i : ready) {
+            if (--jobs[i].remaining <= 0) {
+                jobs[i].pending = false;
+                result.jobs++;
+            }
+        }
+        // Lag against the fluid schedule, at the end of the tick
+        for (size_t i = 0; i < tasks.size(); i++) {
+            const JobState& job = jobs[i];
+            if (job.seq == 0 || t + 1 > job.deadline) continue;
+            double rate = (double)tasks[i].computationTime / deadlineOf(tasks[i]);
+            double lag = rate * (t + 1 - job.release) - (tasks[i].computationTime - job.remaining);
+            result.maxLag = std::max(result.maxLag, std::fabs(lag));
+        }
+    }
+    result.ticks = horizon;
+    return result;
+}
+
+// --- LLREF (continuous time, DP-Fair slices) ---
+MultiprocessorSimulator::Result MultiprocessorSimulator::runFluid(int horizon) const {
+    Result result;
+    std::vector<JobState> jobs(tasks.size());
+    Dispatch dispatch(processors, tasks.size());
+
+    std::vector<int> boundaries{0, horizon};
+    for (const auto& task : tasks) {
+        for (long long r = task.releaseTime; r < horizon; r += task.period) {
+            boundaries.push_back((int)r);
+            if (r + deadlineOf(task) < horizon) boundaries.push_back((int)(r + deadlineOf(task)));
+        }
+    }
+    std::sort(boundaries.begin(), boundaries.end());
+    boundaries.erase(std::unique(boundaries.begin(), boundaries.end()), boundaries.end());
+
+    std::vector<double> local(tasks.size());
+    std::vector<int> ready;
+    for (size_t s = 0; s < boundaries.size(); s++) {
+        int start = boundaries[s];
+        for (size_t i = 0; i < tasks.size(); i++) {
+            if (jobs[i].pending && jobs[i].deadline <= start) {
+                recordMiss(result, tasks[i], jobs[i].deadline);
+                result.ticks = start;
+                return result;
+            }
+        }
+        if (start == horizon) break;
+        int end = boundaries[s + 1];
+
+        // Releases, then the share of every job in this slice
+        for (size_t i = 0; i < tasks.size(); i++) {
+            const Task& task = tasks[i];
+            JobState& job = jobs[i];
+            if (start >= task.releaseTime && (start - task.releaseTime) % task.period == 0) {
+                job.seq++;
+                job.pending = true;
+                job.release = start;
+                job.deadline = start + deadlineOf(task);
+                job.remaining = task.computationTime;
+            }
+            double rate = (double)task.computationTime / deadlineOf(task);
+            local[i] = job.pending && start < job.deadline ? std::min(job.remaining, rate * (end - start)) : 0;
+        }
+
+        double now = start;
+        while (end - now > EPS) {
+            ready.clear();
+            for (size_t i = 0; i < tasks.size(); i++) {
+                if (local[i] > EPS) ready.push_back((int)i);
+            }
+            // Largest local remaining execution first; on ties the running job stays
+            auto first = [&](int a, int b) {
+                if (std::fabs(local[a] - local[b]) > EPS) return local[a] > local[b];
+                bool ra = dispatch.isRunning(a, jobs[a].seq), rb = dispatch.isRunning(b, jobs[b].seq);
+                if (ra != rb) return ra;
+                return a < b;
+            };
+            size_t count = std::min(ready.size(), (size_t)processors);
+            std::partial_sort(ready.begin(), ready.begin() + count, ready.end(), first);
+
+            // Until a running task finishes its share or a waiting one reaches zero local laxity
+            double step = end - now;
+            for (size_t k = 0; k < count; k++) step = std::min(step, local[ready[k]]);
+            double finish = step;
+            for (size_t k = count; k < ready.size(); k++) step = std::min(step, (end - now) - local[ready[k]]);
+            if (step <= EPS) step = finish; // More zero-laxity tasks than processors: the miss shows at the deadline
+            ready.resize(count);
+            dispatch.assign(ready, jobs, result);
+
+            for (int i : ready) {
+                local[i] -= step;
+                jobs[i].remaining -= step;
+                if (jobs[i].remaining <= DONE) {
+                    jobs[i].remaining = 0;
+                    jobs[i].pending = false;
+                    local[i] = 0;
+                    result.jobs++;
+                }
+            }
+            now += step;
+
+            for (size_t i = 0; i < tasks.size(); i++) {
+                const JobState& job = jobs[i];
+                if (job.seq == 0 || now > job.deadline) continue;
+                double rate = (double)tasks[i].computationTime / deadlineOf(tasks[i]);
+                double lag = rate * (now - job.release) - (tasks[i].computationTime - job.remaining);
+                result.maxLag = std::max(result.maxLag, std::fabs(lag));
+            }
+        }
+    }
+    result.ticks = horizon;
+    return result;
+}
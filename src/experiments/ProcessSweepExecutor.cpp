@@ -0,0 +1,182 @@
+#include "../../include/experiments/ProcessSweepExecutor.h"
+#include <atomic>
+#include <cstdio>
+#include <chrono>
+#include <new>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <signal.h>
+#include <unistd.h>
+#endif
+
+ProcessSweepExecutor::ProcessSweepExecutor(int workers, double itemBudgetSeconds)
+    : workers(workers < 1 ? 1 : workers), itemBudgetSeconds(itemBudgetSeconds), restartCount(0) {}
+
+#ifdef _WIN32
+
+std::vector<ProcessSweepExecutor::Record> ProcessSweepExecutor::run(size_t itemCount, const WorkFn& work) {
+    // No fork(): run in-process, without crash isolation
+    std::vector<Record> results(itemCount, {Pending, 0});
+    for (size_t i = 0; i < itemCount; i++) results[i] = {Done, work(i)};
+    return results;
+}
+
+#else
+
+namespace {
+
+int64_t nowNanos() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Layout of the shared mapping: [Header][Slot x workers][Record x items]
+struct Header {
+    std::atomic<int64_t> nextItem;
+};
+
+struct Slot {
+    std::atomic<int64_t> currentItem; // -1 when idle
+    std::atomic<int64_t> startedAt;   // steady clock, ns
+};
+
+void workerLoop(Header* header, Slot* slot, ProcessSweepExecutor::Record* results,
+                const std::vector<size_t>& items, const ProcessSweepExecutor::WorkFn& work) {
+    while (true) {
+        int64_t item = header->nextItem.fetch_add(1);
+        if (item >= (int64_t)items.size()) break;
+
+        slot->startedAt.store(nowNanos());
+        slot->currentItem.store(item);
+
+        uint32_t bits = work(items[item]);
+        results[item].bits = bits;
+        results[item].status = ProcessSweepExecutor::Done;
+
+        slot->currentItem.store(-1);
+    }
+    _exit(0);
+}
+
+} // namespace
+
+std::vector<ProcessSweepExecutor::Record> ProcessSweepExecutor::run(size_t itemCount, const WorkFn& work) {
+    std::vector<Record> out(itemCount, {Pending, 0});
+    std::vector<size_t> items;
+    for (size_t i = 0; i < itemCount; i++) items.push_back(i);
+
+    // A worker killed right after claiming an item leaves it Pending; such
+    // items get one more pass
+    for (int pass = 0; pass < 2 && !items.empty(); pass++) {
+        std::vector<Record> results = runPass(items, work);
+        std::vector<size_t> pending;
+        for (size_t k = 0; k < items.size(); k++) {
+            out[items[k]] = results[k];
+            if (results[k].status == Pending) pending.push_back(items[k]);
+        }
+        items.swap(pending);
+    }
+    return out;
+}
+
+std::vector<ProcessSweepExecutor::Record> ProcessSweepExecutor::runPass(const std::vector<size_t>& items,
+                                                                        const WorkFn& work) {
+    size_t itemCount = items.size();
+    std::vector<Record> out(itemCount, {Pending, 0});
+
+    size_t bytes = sizeof(Header) + sizeof(Slot) * workers + sizeof(Record) * itemCount;
+    void* mem = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED) {
+        for (size_t i = 0; i < itemCount; i++) out[i] = {Done, work(items[i])};
+        return out;
+    }
+
+    Header* header = new (mem) Header;
+    header->nextItem.store(0);
+    Slot* slots = reinterpret_cast<Slot*>(static_cast<char*>(mem) + sizeof(Header));
+    for (int w = 0; w < workers; w++) {
+        new (&slots[w]) Slot;
+        slots[w].currentItem.store(-1);
+        slots[w].startedAt.store(0);
+    }
+    Record* results = reinterpret_cast<Record*>(reinterpret_cast<char*>(slots) + sizeof(Slot) * workers);
+    for (size_t i = 0; i < itemCount; i++) results[i] = {Pending, 0};
+
+    std::vector<pid_t> pids(workers, -1);
+    std::vector<bool> killedForTime(workers, false);
+    std::vector<int64_t> killedItem(workers, -1);
+    int64_t budgetNs = (int64_t)(itemBudgetSeconds * 1e9);
+
+    auto spawn = [&](int w) {
+        slots[w].currentItem.store(-1);
+        killedForTime[w] = false;
+        killedItem[w] = -1;
+        std::fflush(stdout); // Children must not inherit unflushed output
+        pid_t pid = fork();
+        if (pid == 0) workerLoop(header, &slots[w], results, items, work);
+        pids[w] = pid;
+    };
+
+    for (int w = 0; w < workers; w++) spawn(w);
+
+    int alive = 0;
+    for (pid_t p : pids) if (p > 0) alive++;
+
+    while (alive > 0) {
+        // --- REAP EXITED WORKERS ---
+        // Only our own pids: other children of the process are not ours to reap
+        for (int w = 0; w < workers; w++) {
+            if (pids[w] <= 0) continue;
+            int status = 0;
+            if (waitpid(pids[w], &status, WNOHANG) != pids[w]) continue;
+
+            pids[w] = -1;
+            alive--;
+
+            bool clean = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+            int64_t item = slots[w].currentItem.load();
+            if (!clean && item >= 0 && results[item].status != Done) {
+                if (!killedForTime[w]) {
+                    results[item].status = Crashed;
+                    results[item].bits = 0;
+                } else if (item == killedItem[w]) {
+                    results[item].status = TimedOut;
+                    results[item].bits = 0;
+                }
+                // Killed for time after moving on to another item: that
+                // item stays Pending and is retried in the next pass
+            }
+
+            // Replace the worker while there is still work in the queue
+            if (!clean && header->nextItem.load() < (int64_t)itemCount) {
+                restartCount++;
+                spawn(w);
+                if (pids[w] > 0) alive++;
+            }
+        }
+
+        // --- ENFORCE TIME BUDGET ---
+        if (budgetNs > 0) {
+            int64_t now = nowNanos();
+            for (int w = 0; w < workers; w++) {
+                if (pids[w] <= 0 || killedForTime[w]) continue;
+                int64_t item = slots[w].currentItem.load();
+                if (item < 0) continue;
+                if (now - slots[w].startedAt.load() > budgetNs && kill(pids[w], SIGKILL) == 0) {
+                    killedForTime[w] = true;
+                    killedItem[w] = item;
+                }
+            }
+        }
+
+        if (alive > 0) usleep(2000);
+    }
+
+    for (size_t i = 0; i < itemCount; i++) out[i] = results[i];
+    munmap(mem, bytes);
+    return out;
+}
+
+#endif
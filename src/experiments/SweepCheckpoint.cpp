@@ -0,0 +1,77 @@
+#include "../../include/experiments/SweepCheckpoint.h"
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+
+namespace {
+
+const uint64_t CHECKPOINT_MAGIC = 0x31545043504D5452ULL; // "RTMPCPT1"
+
+double nowSeconds() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+} // namespace
+
+SweepCheckpoint::SweepCheckpoint(const std::string& path, uint64_t signature, size_t itemCount)
+    : path(path), signature(signature), done(itemCount, 0), results(itemCount, 0), lastSave(nowSeconds()) {}
+
+bool SweepCheckpoint::load() {
+    std::ifstream in(path, std::ios::binary);
+    if (!in.is_open()) return false;
+
+    uint64_t magic = 0, sig = 0, count = 0;
+    in.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    in.read(reinterpret_cast<char*>(&sig), sizeof(sig));
+    in.read(reinterpret_cast<char*>(&count), sizeof(count));
+    if (!in || magic != CHECKPOINT_MAGIC || sig != signature || count != done.size()) return false;
+
+    std::vector<uint8_t> loadedDone(done.size());
+    std::vector<uint32_t> loadedResults(results.size());
+    in.read(reinterpret_cast<char*>(loadedDone.data()), loadedDone.size());
+    in.read(reinterpret_cast<char*>(loadedResults.data()), loadedResults.size() * sizeof(uint32_t));
+    if (!in) return false;
+
+    done.swap(loadedDone);
+    results.swap(loadedResults);
+    return true;
+}
+
+void SweepCheckpoint::save() {
+    std::string tmp = path + ".tmp";
+    {
+        std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) return;
+        uint64_t count = done.size();
+        out.write(reinterpret_cast<const char*>(&CHECKPOINT_MAGIC), sizeof(CHECKPOINT_MAGIC));
+        out.write(reinterpret_cast<const char*>(&signature), sizeof(signature));
+        out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+        out.write(reinterpret_cast<const char*>(done.data()), done.size());
+        out.write(reinterpret_cast<const char*>(results.data()), results.size() * sizeof(uint32_t));
+        if (!out) return;
+    }
+#ifdef _WIN32
+    std::remove(path.c_str()); // rename() doesn't replace on Windows
+#endif
+    std::rename(tmp.c_str(), path.c_str());
+    lastSave = nowSeconds();
+}
+
+void SweepCheckpoint::saveIfDue(double intervalSeconds) {
+    if (nowSeconds() - lastSave >= intervalSeconds) save();
+}
+
+void SweepCheckpoint::remove() {
+    std::remove(path.c_str());
+}
+
+void SweepCheckpoint::markDone(size_t item, uint32_t bits) {
+    done[item] = 1;
+    results[item] = bits;
+}
+
+size_t SweepCheckpoint::completedCount() const {
+    size_t n = 0;
+    for (uint8_t d : done) n += d;
+    return n;
+}
@@ -0,0 +1,36 @@
+#include "../../include/experiments/TaskSetGenerator.h"
+#include <algorithm>
+#include <cmath>
+
+TaskSet TaskSetGenerator::generate(double utilization, CounterRng& rng) const {
+    // --- UUNIFAST (-DISCARD) ---
+    // Below the cap nothing is ever discarded, so single-processor sets are
+    // drawn exactly as before. Close to taskCount * cap almost every draw
+    // is discarded, so the draws are capped.
+    if (utilization >= config.taskCount * config.maxTaskUtilization) return {};
+    std::vector<double> shares;
+    for (int draw = 0;; draw++) {
+        if (draw == MAX_DRAWS) return {};
+        shares.clear();
+        double sum = utilization;
+        for (int i = 1; i < config.taskCount; i++) {
+            double next = sum * std::pow(rng.uniform(), 1.0 / (config.taskCount - i));
+            shares.push_back(sum - next);
+            sum = next;
+        }
+        shares.push_back(sum);
+        if (*std::max_element(shares.begin(), shares.end()) <= config.maxTaskUtilization) break;
+    }
+
+    TaskSet set;
+    for (int i = 0; i < config.taskCount; i++) {
+        int p = config.periods[rng.below(config.periods.size())];
+        int e = std::max(1, (int)std::round(shares[i] * p));
+
+        double ratio = config.minDeadlineRatio + (1.0 - config.minDeadlineRatio) * rng.uniform();
+        int d = std::max(e, (int)std::round(p * std::min(1.0, ratio)));
+
+        set.push_back(Task(i + 1, TaskType::Periodic, 0, e, p, d));
+    }
+    return set;
+}
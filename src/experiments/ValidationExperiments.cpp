@@ -0,0 +1,554 @@
+#include "../../include/experiments/ValidationExperiments.h"
+#include "../../include/experiments/TaskSetGenerator.h"
+#include "../../include/analysis/IncrementalRTA.h"
+#include "../../include/analysis/SchedulabilityAnalysis.h"
+#include "../../include/analysis/QueueingEstimator.h"
+#include "../../include/analysis/ProbabilisticRTA.h"
+#include "../../include/analysis/HolisticAnalysis.h"
+#include "../../include/experiments/DistributedSimulator.h"
+#include "../../include/utils/TransactionReader.h"
+#include "../../include/experiments/ArrivalGenerator.h"
+#include "../../include/algorithms/AlgorithmFactory.h"
+#include "../../include/core/Scheduler.h"
+#include "../../include/utils/CounterRng.h"
+#include "../../include/utils/ParallelFor.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <mutex>
+
+namespace {
+
+double nowMicros() {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// --- INCREMENTAL RTA ---
+
+// Small random task. The period menu contains SERVER_PERIOD so ties with
+// the server come up; some tasks get jitter, a deadline past the period or
+// a suspension segment.
+Task randomTask(int id, CounterRng& rng) {
+    const int periods[] = {20, 25, 40, 50, 80, 100, 125, 200};
+    int p = periods[rng.below(8)];
+    int c = 1 + (int)rng.below(std::max(1, p / 6));
+    int d = std::max(c, (int)(p * (0.6 + 0.9 * rng.uniform())));
+    int j = rng.uniform() < 0.25 ? (int)rng.below(p / 5 + 1) : 0;
+    Task task(id, TaskType::Periodic, 0, c, p, d, j);
+    if (c >= 2 && d <= p && rng.uniform() < 0.125) {
+        int first = 1 + (int)rng.below(c - 1);
+        task = task.withSegments({first, 1 + (int)rng.below(p / 4), c - first});
+    }
+    return task;
+}
+
+// Response time of every task under the full analysis, by task id
+std::vector<std::pair<int, int>> fullAnalysis(const std::vector<Task>& tasks, AlgorithmKind kind) {
+    std::vector<Task> sorted = SchedulabilityAnalysis::priorityOrder(tasks, kind);
+    std::vector<std::pair<int, int>> responses;
+    for (size_t i = 0; i < sorted.size(); i++) {
+        responses.push_back({sorted[i].id, SchedulabilityAnalysis::responseTime(sorted, i, sorted[i].relativeDeadline)});
+    }
+    std::sort(responses.begin(), responses.end());
+    return responses;
+}
+
+bool agrees(const IncrementalRTA& rta, const std::vector<std::pair<int, int>>& expected) {
+    if (rta.entries().size() != expected.size()) return false;
+    for (const auto& e : expected) {
+        if (rta.responseTime(e.first) != e.second) return false;
+    }
+    return true;
+}
+
+int checkIncremental(AlgorithmKind kind, uint64_t seed, int operations, int maxTasks) {
+    // The admission controller's layout: tasks in insertion order, server last
+    Task server(SERVER_TASK_ID, TaskType::Poller, 0, SERVER_CAPACITY, SERVER_PERIOD, SERVER_PERIOD);
+    std::vector<Task> tasks;
+    IncrementalRTA rta(kind);
+    rta.addTask(server);
+    int nextId = 1, mismatches = 0;
+
+    auto withServer = [&](const std::vector<Task>& list) {
+        std::vector<Task> all = list;
+        all.push_back(server);
+        return all;
+    };
+
+    for (int op = 0; op < operations; op++) {
+        CounterRng rng(seed, (uint64_t)op);
+        double roll = rng.uniform();
+        bool ok = true;
+
+        if (tasks.size() < 3 || (roll < 0.5 && (int)tasks.size() < maxTasks)) {
+            if (nextId == SERVER_TASK_ID) nextId++;
+            Task task = randomTask(nextId++, rng);
+
+            // admits() must predict the analysis of the set with the task in
+            std::vector<Task> trial = tasks;
+            trial.push_back(task);
+            auto expected = fullAnalysis(withServer(trial), kind);
+            std::vector<int> violations, predicted;
+            int response = 0;
+            rta.admits(task, violations, response);
+            for (const auto& e : expected) {
+                if (e.second < 0) predicted.push_back(e.first);
+                if (e.first == task.id && e.second != response) ok = false;
+            }
+            std::sort(violations.begin(), violations.end());
+            if (violations != predicted) ok = false;
+
+            tasks.push_back(task);
+            rta.addTask(task);
+        } else if (roll < 0.8) {
+            size_t k = rng.below(tasks.size());
+            rta.removeTask(tasks[k].id);
+            tasks.erase(tasks.begin() + k);
+        } else {
+            Task& task = tasks[rng.below(tasks.size())];
+            int wcet = 1 + (int)rng.below(std::max(1, task.period / 4));
+            if (task.selfSuspending()) wcet = std::max(wcet, task.segments[0] + 1);
+            task.computationTime = wcet;
+            rta.updateWCET(task.id, wcet);
+        }
+
+        if (!ok || !agrees(rta, fullAnalysis(withServer(tasks), kind))) mismatches++;
+    }
+    return mismatches;
+}
+
+void benchmarkIncremental(uint64_t seed, int taskCount) {
+    TaskSetGenerator::Config gen;
+    gen.taskCount = taskCount;
+    gen.periods = {1000, 2000, 2500, 4000, 5000, 10000};
+    CounterRng setRng(seed, ~0ULL);
+    TaskSet set = TaskSetGenerator(gen).generate(0.5, setRng);
+
+    IncrementalRTA rta(AlgorithmKind::RateMonotonic);
+    for (const auto& t : set) rta.addTask(t);
+
+    const int reps = 200;
+    double incremental = 0.0, full = 0.0;
+    for (int k = 0; k < reps; k++) {
+        CounterRng rng(seed, (uint64_t)k);
+        Task task(taskCount + 1, TaskType::Periodic, 0, 1, gen.periods[rng.below(gen.periods.size())], 0);
+        task.relativeDeadline = task.period;
+
+        double start = nowMicros();
+        std::vector<int> violations;
+        int response = 0;
+        if (rta.admits(task, violations, response)) rta.addTask(task);
+        incremental += nowMicros() - start;
+        rta.removeTask(task.id);
+
+        std::vector<Task> trial = set;
+        trial.push_back(task);
+        start = nowMicros();
+        SchedulabilityAnalysis::fixedPriorityTest(trial, AlgorithmKind::RateMonotonic);
+        full += nowMicros() - start;
+    }
+    std::cout << "BENCH\t" << taskCount << "\t" << incremental / reps << "\t" << full / reps << std::endl;
+}
+
+// --- QUEUEING ESTIMATOR ---
+
+struct QueueingCase {
+    std::string policy;
+    ArrivalGenerator::ExecModel exec;
+    double periodicLoad;
+    double load; // rho the arrivals are sized for
+    int system;
+    uint64_t set;    // Periodic task set stream
+    uint64_t stream; // Arrival stream, shared by the policies of a configuration
+};
+
+double relativeError(double estimate, double simulated) {
+    return simulated > 0 ? std::fabs(estimate - simulated) / simulated : 0.0;
+}
+
+double median(std::vector<double> values) {
+    if (values.empty()) return 0.0;
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+// --- PROBABILISTIC RTA ---
+
+// Random RM set with a three-point execution profile per task (half, the
+// nominal and 1.8 times the nominal execution time), heavy enough that the
+// tails miss now and then. Deadlines stay within the grid (step 1).
+TaskSet randomProfiledSet(int taskCount, CounterRng& rng, std::map<int, ExecutionProfileReader::Profile>& profiles) {
+    TaskSetGenerator::Config gen;
+    gen.taskCount = taskCount;
+    gen.minDeadlineRatio = 0.7;
+    gen.periods = {20, 25, 40, 50, 80, 100, 125, 200};
+    TaskSet set = TaskSetGenerator(gen).generate(0.6 + 0.25 * rng.uniform(), rng);
+
+    profiles.clear();
+    for (const auto& t : set) {
+        std::map<int, double> mass;
+        mass[std::max(1, t.computationTime / 2)] += 0.3;
+        mass[t.computationTime] += 0.6;
+        mass[std::max(1, (int)std::round(t.computationTime * 1.8))] += 0.1;
+        ExecutionProfileReader::Profile& profile = profiles[t.id];
+        profile.points.assign(mass.begin(), mass.end());
+    }
+    return set;
+}
+
+int sampleExecution(const ExecutionProfileReader::Profile& profile, CounterRng& rng) {
+    double u = rng.uniform(), cumulative = 0;
+    for (const auto& [ticks, probability] : profile.points) {
+        cumulative += probability;
+        if (u < cumulative) return ticks;
+    }
+    return profile.points.back().first;
+}
+
+struct ProbabilisticCheck {
+    double missAnalysis, missSimulated;
+    double distance; // Largest gap between the two CDFs up to the deadline
+};
+
+// The first job of sorted[i] at the synchronous critical instant, with
+// execution times drawn per job: it completes at the first t where its own
+// demand plus every higher-priority job released before t is done
+ProbabilisticCheck sampleFirstJob(const std::vector<Task>& sorted, size_t i, const ProbabilisticRTA::Result& result,
+                                  const std::map<int, ExecutionProfileReader::Profile>& profiles, int samples,
+                                  CounterRng& rng) {
+    int deadline = result.deadline;
+    std::vector<std::pair<long long, size_t>> releases;
+    for (size_t j = 0; j < i; j++) {
+        for (long long r = sorted[j].period; r < deadline; r += sorted[j].period) releases.push_back({r, j});
+    }
+    std::sort(releases.begin(), releases.end());
+
+    std::vector<long long> counts(deadline + 1, 0);
+    long long misses = 0;
+    for (int s = 0; s < samples; s++) {
+        long long t = 0;
+        for (size_t j = 0; j <= i; j++) t += sampleExecution(profiles.at(sorted[j].id), rng);
+        for (const auto& [release, j] : releases) {
+            if (release >= t) break;
+            t += sampleExecution(profiles.at(sorted[j].id), rng);
+        }
+        if (t > deadline) misses++;
+        else counts[t]++;
+    }
+
+    ProbabilisticCheck check{result.missProbability(), (double)misses / samples, 0.0};
+    const auto& p = result.response.p;
+    double analysed = 0, simulated = 0;
+    for (int t = 0; t <= deadline; t++) {
+        if (t % result.response.step == 0 && (size_t)(t / result.response.step) < p.size()) {
+            analysed += p[t / result.response.step];
+        }
+        simulated += (double)counts[t] / samples;
+        check.distance = std::max(check.distance, std::fabs(analysed - simulated));
+    }
+    return check;
+}
+
+// Largest error of the FFT convolution against the direct sum, relative
+// to the largest output value
+double fftError(size_t length, CounterRng& rng) {
+    std::vector<double> a(length), b(length / 2 + 1);
+    for (auto& x : a) x = rng.uniform();
+    for (auto& x : b) x = rng.uniform();
+    bool usedFft = false;
+    std::vector<double> fast = ProbabilisticRTA::convolve(a, b, usedFft);
+
+    std::vector<double> direct(a.size() + b.size() - 1, 0.0);
+    for (size_t i = 0; i < a.size(); i++) {
+        for (size_t j = 0; j < b.size(); j++) direct[i + j] += a[i] * b[j];
+    }
+    double largest = *std::max_element(direct.begin(), direct.end()), error = 0;
+    for (size_t k = 0; k < direct.size(); k++) error = std::max(error, std::fabs(fast[k] - direct[k]));
+    return error / largest;
+}
+
+// --- HOLISTIC ANALYSIS ---
+
+// Two or three nodes with random algorithms, a link both ways between every
+// pair (1-5 ticks, plus up to 10 of jitter) and two to four transactions of
+// one to three steps. Periods divide 2000 ticks; each transaction takes a
+// share of utilization on the nodes it visits and gets an end-to-end
+// deadline between one and two periods.
+DistributedSystem randomDistributedSystem(CounterRng& rng) {
+    const AlgorithmKind kinds[] = {AlgorithmKind::RateMonotonic, AlgorithmKind::DeadlineMonotonic,
+                                   AlgorithmKind::EDF, AlgorithmKind::LeastSlackTime};
+    const int periods[] = {50, 80, 100, 125, 200, 250, 400, 500};
+
+    DistributedSystem system;
+    int nodes = 2 + (int)rng.below(2);
+    for (int n = 1; n <= nodes; n++) system.nodes.push_back({n, kinds[rng.below(4)]});
+    for (int a = 1; a <= nodes; a++) {
+        for (int b = 1; b <= nodes; b++) {
+            if (a == b) continue;
+            int latency = 1 + (int)rng.below(5);
+            system.links.push_back({a, b, latency, latency + (int)rng.below(11)});
+        }
+    }
+
+    int transactions = 2 + (int)rng.below(3), taskId = 1;
+    double share = (0.4 + 0.8 * rng.uniform()) / transactions; // Per node visit
+    for (int t = 1; t <= transactions; t++) {
+        Transaction tr;
+        tr.id = t;
+        tr.period = periods[rng.below(8)];
+        tr.deadline = (int)(tr.period * (1.0 + rng.uniform()));
+        int steps = 1 + (int)rng.below(3);
+        for (int k = 0; k < steps; k++) {
+            int node = 1 + (int)rng.below(nodes);
+            int exec = std::max(1, (int)std::round(tr.period * share * (0.5 + rng.uniform()) / steps));
+            tr.steps.push_back({node, exec, taskId++, 0});
+        }
+        system.transactions.push_back(tr);
+    }
+    TransactionReader::splitDeadlines(system);
+    return system;
+}
+
+// Observed releases and responses outside the analysed bounds
+int boundViolations(const DistributedSystem& system, const HolisticAnalysis::Result& analysis,
+                    const DistributedSimulator::Result& sim) {
+    int violations = 0;
+    size_t s = 0;
+    for (size_t i = 0; i < system.transactions.size(); i++) {
+        const auto& stats = sim.transactions[i];
+        for (size_t k = 0; k < system.transactions[i].steps.size(); k++, s++) {
+            const auto& bound = analysis.steps[s];
+            const auto& observed = stats.steps[k];
+            if (observed.jobs == 0 || bound.response < 0) continue;
+            if (observed.minRelease < bound.offset) violations++;
+            if (observed.maxRelease - observed.minRelease > bound.jitter) violations++;
+            if (observed.maxResponse > bound.response) violations++;
+        }
+        if (analysis.endToEnd[i] >= 0 && stats.maxResponse > analysis.endToEnd[i]) violations++;
+    }
+    return violations;
+}
+
+bool sameOutcome(const DistributedSimulator::Result& a, const DistributedSimulator::Result& b) {
+    if (a.deadlineMiss != b.deadlineMiss || a.missTime != b.missTime || a.ticks != b.ticks ||
+        a.messages != b.messages || a.transactions.size() != b.transactions.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.transactions.size(); i++) {
+        const auto& x = a.transactions[i];
+        const auto& y = b.transactions[i];
+        if (x.completed != y.completed || x.maxResponse != y.maxResponse || x.sumResponse != y.sumResponse) return false;
+        for (size_t k = 0; k < x.steps.size(); k++) {
+            if (x.steps[k].jobs != y.steps[k].jobs || x.steps[k].minRelease != y.steps[k].minRelease ||
+                x.steps[k].maxRelease != y.steps[k].maxRelease || x.steps[k].maxResponse != y.steps[k].maxResponse) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int ValidationExperiments::incrementalRTA(const Config& config) {
+    int operations = config.count > 0 ? config.count : 3000;
+    int maxTasks = config.taskCount > 0 ? config.taskCount : 12;
+
+    int mismatches = 0;
+    for (AlgorithmKind kind : {AlgorithmKind::RateMonotonic, AlgorithmKind::DeadlineMonotonic}) {
+        int m = checkIncremental(kind, config.seed, operations, maxTasks);
+        std::cout << "INCREMENTAL\t" << shortName(kind) << "\t" << operations << "\t" << m << std::endl;
+        mismatches += m;
+    }
+    benchmarkIncremental(config.seed, 300);
+    return mismatches;
+}
+
+int ValidationExperiments::queueingEstimator(const Config& config) {
+    int systems = config.count > 0 ? config.count : 4;
+    int taskCount = config.taskCount > 0 ? config.taskCount : 4;
+    const char* policies[] = {"Background", "Poller", "Deferrable"};
+
+    std::vector<QueueingCase> cases;
+    uint64_t set = 0, stream = 0;
+    for (int s = 0; s < systems; s++) {
+        for (double up : {0.2, 0.4}) {
+            set++;
+            for (auto exec : {ArrivalGenerator::ExecModel::Exponential, ArrivalGenerator::ExecModel::Pareto}) {
+                for (double load : {0.2, 0.4, 0.6}) {
+                    for (const char* policy : policies) cases.push_back({policy, exec, up, load, s, set, stream});
+                    stream++;
+                }
+            }
+        }
+    }
+
+    struct Outcome {
+        double estimateMean, estimateP99, simulatedMean, simulatedP99;
+    };
+    std::vector<Outcome> outcomes(cases.size());
+    std::mutex out;
+    parallelFor(cases.size(), config.threads, [&](size_t i) {
+        const QueueingCase& c = cases[i];
+        TaskSetGenerator::Config gen;
+        gen.taskCount = taskCount;
+        CounterRng setRng(config.seed, ~c.set);
+        TaskSet periodic = TaskSetGenerator(gen).generate(c.periodicLoad, setRng);
+        double busy = 0;
+        for (const auto& t : periodic) busy += (double)t.computationTime / t.period;
+
+        ArrivalGenerator::Config arrivals;
+        arrivals.exec = c.exec;
+        arrivals.meanExec = 0.5;
+        arrivals.rate = c.load * (1.0 - busy) / arrivals.meanExec;
+        arrivals.count = 20000;
+        arrivals.seed = CounterRng(config.seed, c.stream)();
+        ArrivalGenerator stream(arrivals);
+
+        QueueingEstimator::Workload workload{stream.meanRate() / 10.0, arrivals.meanExec * 10.0,
+                                             stream.execSecondMoment() * 100.0};
+        auto e = QueueingEstimator::estimate(workload, c.policy, periodic, AlgorithmKind::RateMonotonic,
+                                             SERVER_CAPACITY, SERVER_PERIOD);
+
+        ISchedulingAlgorithm* algo = createAlgorithm(AlgorithmKind::RateMonotonic);
+        Scheduler scheduler(periodic, {}, algo, c.policy);
+        scheduler.setVerbose(false);
+        scheduler.setRecordHistory(false);
+        scheduler.setArrivalStream(&stream);
+        scheduler.run();
+        std::vector<int> r = scheduler.aperiodicResponseTimes();
+        std::vector<int> waiting = scheduler.aperiodicBacklogAges();
+        r.insert(r.end(), waiting.begin(), waiting.end());
+        std::sort(r.begin(), r.end());
+        delete algo;
+
+        double mean = 0;
+        for (int v : r) mean += v;
+        mean = r.empty() ? 0.0 : mean / r.size();
+        double p99 = r.empty() ? 0.0 : r[std::min(r.size(), std::max<size_t>(1, (size_t)std::ceil(0.99 * r.size()))) - 1];
+        outcomes[i] = {e.meanResponse / 10.0, e.percentile(0.99) / 10.0, mean / 10.0, p99 / 10.0};
+
+        std::lock_guard<std::mutex> lock(out);
+        std::cout << "QUEUEING\t" << c.policy << "\t"
+                  << (c.exec == ArrivalGenerator::ExecModel::Pareto ? "pareto" : "exp") << "\t" << c.system << "\t"
+                  << busy << "\t" << e.load << "\t" << outcomes[i].estimateMean << "\t" << outcomes[i].simulatedMean
+                  << "\t" << outcomes[i].estimateP99 << "\t" << outcomes[i].simulatedP99 << std::endl;
+    });
+
+    for (const char* policy : policies) {
+        std::vector<double> meanErrors, p99Errors;
+        for (size_t i = 0; i < cases.size(); i++) {
+            if (cases[i].policy != policy) continue;
+            meanErrors.push_back(relativeError(outcomes[i].estimateMean, outcomes[i].simulatedMean));
+            p99Errors.push_back(relativeError(outcomes[i].estimateP99, outcomes[i].simulatedP99));
+        }
+        std::cout << "QUEUEING_ERROR\t" << policy << "\t" << meanErrors.size() << "\t" << median(meanErrors)
+                  << "\t" << *std::max_element(meanErrors.begin(), meanErrors.end()) << "\t" << median(p99Errors)
+                  << "\t" << *std::max_element(p99Errors.begin(), p99Errors.end()) << std::endl;
+    }
+
+    // Ranking: the policies of one configuration are consecutive cases
+    int mismatches = 0;
+    for (size_t i = 0; i < cases.size(); i++) {
+        for (size_t j = i + 1; j < cases.size() && cases[j].stream == cases[i].stream; j++) {
+            const Outcome& a = outcomes[i];
+            const Outcome& b = outcomes[j];
+            double gap = std::fabs(a.simulatedMean - b.simulatedMean) / std::min(a.simulatedMean, b.simulatedMean);
+            bool inverted = (a.estimateMean < b.estimateMean) != (a.simulatedMean < b.simulatedMean);
+            if (inverted && gap > QUEUEING_RANK_GAP) {
+                std::cout << "QUEUEING_RANK\t" << cases[i].policy << "\t" << cases[j].policy << "\t"
+                          << cases[i].stream << "\t" << gap << std::endl;
+                mismatches++;
+            }
+        }
+    }
+    return mismatches;
+}
+
+int ValidationExperiments::probabilisticRTA(const Config& config) {
+    int sets = config.count > 0 ? config.count : 40;
+    int taskCount = config.taskCount > 0 ? config.taskCount : 4;
+    const int samples = 200000;
+    // Dvoretzky-Kiefer-Wolfowitz: P(distance > bound) <= 2 exp(-2 n bound^2)
+    const double bound = std::sqrt(std::log(2.0 / PRTA_FALSE_ALARM) / (2.0 * samples));
+
+    std::vector<int> disagreements(sets, 0);
+    std::mutex out;
+    parallelFor(sets, config.threads, [&](size_t s) {
+        CounterRng rng(config.seed, (uint64_t)s);
+        std::map<int, ExecutionProfileReader::Profile> profiles;
+        TaskSet set = randomProfiledSet(taskCount, rng, profiles);
+        std::vector<Task> sorted = SchedulabilityAnalysis::priorityOrder(set, AlgorithmKind::RateMonotonic);
+        auto results = ProbabilisticRTA::analyse(set, AlgorithmKind::RateMonotonic, profiles);
+
+        for (size_t i = 0; i < sorted.size(); i++) {
+            CounterRng sampler(config.seed, ((uint64_t)(s + 1) << 32) | i);
+            ProbabilisticCheck check = sampleFirstJob(sorted, i, results[i], profiles, samples, sampler);
+            if (check.distance > bound) disagreements[s]++;
+
+            std::lock_guard<std::mutex> lock(out);
+            std::cout << "PRTA_MC\t" << s << "\t" << sorted[i].id << "\t" << check.missAnalysis << "\t"
+                      << check.missSimulated << "\t" << check.distance << std::endl;
+        }
+    });
+
+    int mismatches = 0;
+    for (int d : disagreements) mismatches += d;
+    std::cout << "PRTA_BOUND\t" << samples << "\t" << bound << "\t" << mismatches << std::endl;
+
+    for (size_t length : {128, 1024, 8192}) {
+        CounterRng rng(config.seed, ~(uint64_t)length);
+        double error = fftError(length, rng);
+        if (error > FFT_TOLERANCE) mismatches++;
+        std::cout << "FFT\t" << length << "\t" << error << std::endl;
+    }
+    return mismatches;
+}
+
+int ValidationExperiments::holisticAnalysis(const Config& config) {
+    int systems = config.count > 0 ? config.count : 300;
+
+    struct Outcome {
+        bool schedulable = false, missed = false, sameWithThreads = true;
+        int violations = 0;
+    };
+    std::vector<Outcome> outcomes(systems);
+    std::mutex out;
+    // Systems in parallel; each one is simulated with 1 and with 4 workers
+    parallelFor(systems, std::max(1, config.threads / 4), [&](size_t i) {
+        CounterRng rng(config.seed, (uint64_t)i);
+        DistributedSystem system = randomDistributedSystem(rng);
+        auto analysis = HolisticAnalysis::analyse(system);
+
+        DistributedSimulator::Config sim;
+        sim.seed = config.seed + i;
+        sim.threads = 1;
+        auto single = DistributedSimulator(system, sim).run();
+        sim.threads = 4;
+        auto parallel = DistributedSimulator(system, sim).run();
+
+        Outcome& o = outcomes[i];
+        o.schedulable = analysis.schedulable;
+        o.missed = single.deadlineMiss;
+        o.violations = boundViolations(system, analysis, single);
+        o.sameWithThreads = sameOutcome(single, parallel);
+
+        std::lock_guard<std::mutex> lock(out);
+        std::cout << "HOLISTIC\t" << i << "\t" << system.nodes.size() << "\t" << system.transactions.size() << "\t"
+                  << (o.schedulable ? "SCHEDULABLE" : "UNSCHEDULABLE") << "\t" << (o.missed ? "DEADLINE_MISS" : "OK")
+                  << "\t" << o.violations << "\t" << (o.sameWithThreads ? "SAME" : "DIFFERENT") << std::endl;
+    });
+
+    int schedulable = 0, missed = 0, violations = 0, missedWhenSchedulable = 0, different = 0;
+    for (const auto& o : outcomes) {
+        schedulable += o.schedulable;
+        missed += o.missed;
+        violations += o.violations;
+        missedWhenSchedulable += o.schedulable && o.missed;
+        different += !o.sameWithThreads;
+    }
+    std::cout << "HOLISTIC_SUMMARY\t" << systems << "\t" << schedulable << "\t" << missed << "\t" << violations
+              << "\t" << missedWhenSchedulable << "\t" << different << std::endl;
+    return violations + missedWhenSchedulable + different;
+}
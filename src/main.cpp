@@ -7,24 +7,1215 @@
 #include "../include/algorithms/DeadlineMonotonic.h"
 #include "../include/algorithms/EDF.h"
 #include "../include/algorithms/LeastSlackTime.h"
+#include "../include/utils/CommandLine.h"
+#include "../include/experiments/ExperimentDriver.h"
+#include "../include/experiments/ValidationExperiments.h"
+#include "../include/analysis/AnalysisCache.h"
+#include "../include/utils/InputCache.h"
+#include "../include/utils/FileWatcher.h"
+#include "../include/service/AdmissionServer.h"
+#include "../include/analysis/CyclicExecutive.h"
+#include "../include/analysis/ServerAnalysis.h"
+#include "../include/analysis/QueueingEstimator.h"
+#include "../include/analysis/ProbabilisticRTA.h"
+#include "../include/analysis/ExtremeValueFit.h"
+#include "../include/utils/MeasurementReader.h"
+#include "../include/analysis/SchedTraceModel.h"
+#include "../include/analysis/HolisticAnalysis.h"
+#include "../include/experiments/DistributedSimulator.h"
+#include "../include/experiments/MultiprocessorSimulator.h"
+#include "../include/experiments/TaskSetGenerator.h"
+#include "../include/utils/TransactionReader.h"
+#include "../include/analysis/SchedulabilityAnalysis.h"
+#include "../include/utils/ArrivalTraceReader.h"
+#include "../include/experiments/ArrivalGenerator.h"
+#include "../include/utils/ParallelFor.h"
+#include <thread>
+#include <atomic>
+#include <csignal>
+#include <cctype>
+#include <chrono>
+#include <memory>
+#include <map>
+#include <fstream>
+#include <sstream>
+#include <cmath>
+
+// --- NON-INTERACTIVE MODES ---
+
+// rt_scheduler --experiment [out.tsv] [--mode analysis|simulation] [--sets N]
+//              [--tasks N] [--umin U] [--umax U] [--ustep U] [--threads N]
+//              [--seed S] [--deadline-ratio R] [--isolate] [--item-timeout SEC]
+//              [--checkpoint-interval SEC] [--columnar DIR]
+// rt_scheduler --experiment --mode incremental|queueing|prta|holistic [--count N] [--tasks N]
+//              [--seed S] [--threads N]
+//              (validation checks, see ValidationExperiments.h; exit code 2
+//              on any disagreement)
+static int runValidation(const CommandLine& cli, const std::string& mode) {
+    ValidationExperiments::Config config;
+    config.seed = (uint64_t)cli.getInt("--seed", 1);
+    config.count = cli.getInt("--count", 0);
+    config.taskCount = cli.getInt("--tasks", 0);
+    config.threads = cli.getInt("--threads", (int)std::max(1u, std::thread::hardware_concurrency()));
+
+    int mismatches = 0;
+    if (mode == "incremental") mismatches = ValidationExperiments::incrementalRTA(config);
+    else if (mode == "queueing") mismatches = ValidationExperiments::queueingEstimator(config);
+    else if (mode == "prta") mismatches = ValidationExperiments::probabilisticRTA(config);
+    else if (mode == "holistic") mismatches = ValidationExperiments::holisticAnalysis(config);
+    return mismatches > 0 ? 2 : 0;
+}
+
+static int runExperiment(const CommandLine& cli) {
+    std::string mode = cli.get("--mode");
+    if (mode == "incremental" || mode == "queueing" || mode == "prta" || mode == "holistic") {
+        return runValidation(cli, mode);
+    }
+
+    ExperimentDriver::Config config;
+    std::string out = cli.get("--experiment");
+    if (!out.empty() && out.compare(0, 2, "--") != 0) config.outputPath = out;
+
+    config.mode = cli.get("--mode") == "simulation" ? ExperimentDriver::Mode::Simulation
+                                                     : ExperimentDriver::Mode::Analysis;
+    config.setsPerBucket = cli.getInt("--sets", config.setsPerBucket);
+    config.generator.taskCount = cli.getInt("--tasks", config.generator.taskCount);
+    config.generator.minDeadlineRatio = cli.getDouble("--deadline-ratio", config.generator.minDeadlineRatio);
+    config.minUtilization = cli.getDouble("--umin", config.minUtilization);
+    config.maxUtilization = cli.getDouble("--umax", config.maxUtilization);
+    config.utilizationStep = cli.getDouble("--ustep", config.utilizationStep);
+    config.threads = cli.getInt("--threads", (int)std::max(1u, std::thread::hardware_concurrency()));
+    config.seed = (uint64_t)cli.getInt("--seed", 1);
+    config.isolate = cli.has("--isolate");
+    config.itemTimeoutSeconds = cli.getDouble("--item-timeout", config.itemTimeoutSeconds);
+    config.checkpointSeconds = cli.getDouble("--checkpoint-interval", config.checkpointSeconds);
+    std::string columnar = cli.get("--columnar");
+    if (columnar.compare(0, 2, "--") != 0) config.columnarDir = columnar;
+    if (config.maxUtilization >= config.generator.taskCount * config.generator.maxTaskUtilization) {
+        std::cout << "Error: --umax must stay below --tasks (no task above utilization 1)" << std::endl;
+        return 1;
+    }
+
+    ExperimentDriver driver(config);
+    driver.run();
+    return 0;
+}
+
+// --- PROGRESS STREAMING (--progress) ---
+// Protocol lines on stdout, one record per line, tab separated:
+//   SLICE <task> <start tick> <end tick> <description>   executed interval
+//   MISS <tick> <task>                                    deadline miss
+//   PROGRESS <tick> <hyperperiod> <events> <misses>       after each batch
+// Writing "cancel" on stdin (or SIGINT/SIGTERM) stops the run at the next
+// tick; the partial schedule is still exported.
+
+static std::atomic<bool> cancelRequested(false);
+
+static void onCancelSignal(int) { cancelRequested = true; }
+
+static void streamProgress(const Scheduler& scheduler, const ProgressInfo& info, size_t& sent) {
+    const auto& history = scheduler.history;
+
+    // Merge consecutive execution ticks of the same task into one slice
+    int sliceTask = -1, sliceStart = 0, sliceEnd = 0;
+    std::string sliceDesc;
+    auto flush = [&]() {
+        if (sliceTask != -1) {
+            std::cout << "SLICE\t" << sliceTask << "\t" << sliceStart << "\t" << sliceEnd << "\t" << sliceDesc << "\n";
+        }
+        sliceTask = -1;
+    };
+
+    for (; sent < history.size(); sent++) {
+        const TimelineEvent& e = history[sent];
+        if (e.type == "DEADLINE_MISS") {
+            std::cout << "MISS\t" << e.time << "\t" << e.taskId << "\n";
+            continue;
+        }
+        bool exec = e.type == "Running" || e.type == "BackgroundRun" ||
+                    e.type.find("ServerExec") != std::string::npos;
+        if (!exec) continue;
+
+        std::string desc = scheduler.describe(e);
+        if (e.taskId == sliceTask && e.time == sliceEnd && desc == sliceDesc) {
+            sliceEnd = e.time + 1;
+        } else {
+            flush();
+            sliceTask = e.taskId;
+            sliceStart = e.time;
+            sliceEnd = e.time + 1;
+            sliceDesc = desc;
+        }
+    }
+    flush();
+
+    std::cout << "PROGRESS\t" << info.tick << "\t" << info.hyperperiod << "\t"
+              << info.events << "\t" << info.misses << std::endl;
+}
+
+// --- WATCH MODE (--watch) ---
+// rt_scheduler --watch [--algorithm 1-4] [--input FILE]
+// Re-simulates whenever the input file is saved and rewrites output.txt /
+// output_lod.bin atomically. Unchanged lines keep their parsed tasks, edits
+// that don't change the task set (comments, spacing) skip the run, and
+// response times are reused for tasks whose higher-priority set is the same.
+// One status line per reload on stdout:
+//   UPDATED <ms> <reparsed lines>/<lines> <cached RTA>/<tasks> <OK|DEADLINE_MISS> <SCHEDULABLE|UNSCHEDULABLE>
+//   RTA <task> <response ticks or -1> <deadline ticks>     (RM/DM, one per task)
+//   ESTIMATE <policy> <load> <mean ticks> <p99 ticks>      (two or more A lines;
+//            queueing-model aperiodic response, inf = unstable)
+//   UNCHANGED <reparsed lines>/<lines>
+
+static std::string taskSetSignature(const FileReader::ParseResult& input, AlgorithmKind kind) {
+    std::string sig = std::to_string((int)kind) + "|" + input.serverPolicy;
+    for (const auto* list : {&input.periodicTasks, &input.aperiodicTasks}) {
+        for (const auto& t : *list) {
+            sig += "|" + std::to_string(t.id) + "," + std::to_string((int)t.type) + "," +
+                   std::to_string(t.releaseTime) + "," + std::to_string(t.computationTime) + "," +
+                   std::to_string(t.period) + "," + std::to_string(t.relativeDeadline) + "," + std::to_string(t.jitter);
+            for (int k = 0; k < t.segmentCount; k++) sig += (k ? "/" : ",") + std::to_string(t.segments[k]);
+        }
+    }
+    return sig;
+}
+
+static int runWatch(const CommandLine& cli) {
+    std::string inputPath = cli.get("--input", "../../data/input.txt");
+    AlgorithmKind kind = (AlgorithmKind)std::min(4, std::max(1, cli.getInt("--algorithm", 1)));
+
+    std::signal(SIGINT, onCancelSignal);
+    std::signal(SIGTERM, onCancelSignal);
+
+    InputCache inputs;
+    AnalysisCache analysis;
+    FileWatcher watcher(inputPath);
+    std::string lastSignature;
+
+    std::cout << "Watching " << inputPath << (watcher.usesInotify() ? " (inotify)" : " (polling)")
+              << ", algorithm " << shortName(kind) << std::endl;
+
+    while (!cancelRequested) {
+        auto started = std::chrono::steady_clock::now();
+        auto result = inputs.load(inputPath);
+        std::string lines = std::to_string(inputs.reparsedCount()) + "/" + std::to_string(inputs.lineCount());
+        std::string signature = taskSetSignature(result, kind);
+
+        if (signature == lastSignature) {
+            std::cout << "UNCHANGED\t" << lines << std::endl;
+        } else if (result.periodicTasks.empty() && result.aperiodicTasks.empty()) {
+            lastSignature = signature;
+            std::cout << "Error: No tasks found in " << inputPath << std::endl;
+        } else {
+            lastSignature = signature;
+            auto verdict = analysis.analyse(result.periodicTasks, kind, result.serverPolicy);
+
+            ISchedulingAlgorithm* algo = createAlgorithm(kind);
+            Scheduler scheduler(result.periodicTasks, result.aperiodicTasks, algo, result.serverPolicy);
+            scheduler.setVerbose(false);
+            scheduler.setCancelFlag(&cancelRequested);
+            scheduler.run();
+            scheduler.exportToFile("output.txt");
+            scheduler.exportPyramid("output_lod.bin");
+            bool missed = scheduler.hasDeadlineMiss();
+            delete algo;
+
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started).count();
+            std::cout << "UPDATED\t" << ms << "\t" << lines << "\t" << analysis.hitCount() << "/"
+                      << (analysis.hitCount() + analysis.computedCount()) << "\t"
+                      << (missed ? "DEADLINE_MISS" : "OK") << "\t"
+                      << (verdict.schedulable ? "SCHEDULABLE" : "UNSCHEDULABLE") << "\n";
+            for (const auto& t : verdict.tasks) {
+                std::cout << "RTA\t" << t.taskId << "\t" << t.responseTime << "\t" << t.deadline << "\n";
+            }
+            if (result.aperiodicTasks.size() >= 2) {
+                auto workload = QueueingEstimator::fromArrivals(result.aperiodicTasks);
+                auto e = QueueingEstimator::estimate(workload, result.serverPolicy, result.periodicTasks, kind,
+                                                     SERVER_CAPACITY, SERVER_PERIOD);
+                std::cout << "ESTIMATE\t" << result.serverPolicy << "\t" << e.load << "\t" << e.meanResponse
+                          << "\t" << e.percentile(0.99) << "\n";
+            }
+            std::cout << std::flush;
+        }
+
+        while (!cancelRequested && !watcher.waitForChange(500)) {}
+    }
+    return 0;
+}
+
+// --- ADMISSION SERVICE (--daemon) ---
+// rt_scheduler --daemon [SOCKET] [--algorithm 1-4] [--input FILE] [--policy Poller|Deferrable]
+// Keeps a task set and its analysis in memory and answers admission
+// queries on a Unix domain socket (protocol in AdmissionController.h).
+// Starts empty unless --input preloads the periodic tasks of a file.
+
+static int runDaemon(const CommandLine& cli) {
+    std::string socketPath = cli.get("--daemon");
+    if (socketPath.empty() || socketPath.compare(0, 2, "--") == 0) socketPath = "/tmp/rt_admission.sock";
+    AlgorithmKind kind = (AlgorithmKind)std::min(4, std::max(1, cli.getInt("--algorithm", 1)));
+
+    FileReader::ParseResult input;
+    input.serverPolicy = cli.get("--policy", "Background");
+    if (cli.has("--input")) {
+        input = FileReader::readInputFile(cli.get("--input"));
+        if (cli.has("--policy")) input.serverPolicy = cli.get("--policy");
+    }
+
+    AdmissionController controller(kind, input.serverPolicy);
+    controller.load(input.periodicTasks);
+
+    std::signal(SIGINT, onCancelSignal);
+    std::signal(SIGTERM, onCancelSignal);
+
+    std::cout << "Admission service on " << socketPath << ", algorithm " << shortName(kind)
+              << ", " << controller.tasks().size() << " task(s) loaded" << std::endl;
+    AdmissionServer server(controller, socketPath);
+    if (!server.run(cancelRequested)) return 1;
+
+    std::cout << "Admission service stopped after " << server.requestCount() << " request(s)" << std::endl;
+    return 0;
+}
+
+// --- CYCLIC EXECUTIVE (--cyclic) ---
+// rt_scheduler --cyclic [NAME] [--input FILE] [--policy Poller|Deferrable]
+// Synthesizes a frame-based dispatch table for the periodic tasks (plus the
+// server's budget under Poller/Deferrable, which the server then spends on
+// aperiodic work) and writes ../../data/NAME.bin and NAME.h, default
+// "cyclic_table". A table dispatcher needs no scheduler at run time: the
+// current frame is t / FRAME_SIZE.
+
+static int runCyclic(const CommandLine& cli) {
+    std::string name = cli.get("--cyclic");
+    if (name.empty() || name.compare(0, 2, "--") == 0) name = "cyclic_table";
+    std::string inputPath = cli.get("--input", "../../data/input.txt");
+
+    auto input = FileReader::readInputFile(inputPath);
+    std::string policy = cli.get("--policy", input.serverPolicy);
+    auto tasks = SchedulabilityAnalysis::withServer(input.periodicTasks, policy);
+    if (tasks.empty()) {
+        std::cout << "Error: No periodic tasks found in " << inputPath << std::endl;
+        return 1;
+    }
+
+    auto result = CyclicExecutive::synthesize(tasks);
+    if (!result.feasible) {
+        std::cout << "No cyclic schedule: " << result.reason << " (" << result.framesTried
+                  << " of " << result.candidates.size() << " frame size(s) tried)" << std::endl;
+        return 1;
+    }
+
+    const DispatchTable& table = result.table;
+    std::cout << "Hyperperiod (Ticks): " << result.hyperperiod << ", frame size: " << result.frameSize
+              << " (" << table.steps.size() << " frames, " << result.framesTried << " size(s) tried)\n";
+    std::cout << "Jobs: " << result.jobs << ", split across frames: " << result.splitJobs << "\n";
+    std::cout << "Table: " << table.blocks.size() << " distinct frame(s), " << table.slots.size() << " slot(s)\n";
+    for (const auto& [taskId, busy] : table.busyTicks()) {
+        std::cout << "  Task " << taskId << ": " << busy << " ticks per cycle\n";
+    }
+
+    // Namespace for the generated header: NAME with non-identifier characters replaced
+    std::string ns = "rt_" + name;
+    for (char& c : ns) {
+        if (!std::isalnum((unsigned char)c)) c = '_';
+    }
+
+    std::string base = "../../data/" + name;
+    if (!table.writeBinary(base + ".bin") ||
+        !table.writeHeader(base + ".h", ns, "cyclic executive for " + inputPath)) {
+        std::cout << "Error opening file: " << base << ".bin / .h" << std::endl;
+        return 1;
+    }
+    std::cout << "Dispatch table saved to " << base << ".bin and " << base << ".h" << std::endl;
+    return 0;
+}
+
+// --- APERIODIC WORKLOAD (--workload) ---
+// rt_scheduler --workload [out.tsv] [--input FILE] [--algorithm 1-4]
+//              [--policy Poller|Deferrable|Background|all] [--count N] [--seed S]
+//              [--arrival poisson|mmpp] [--rate R] [--mmpp-rates R1,R2,..] [--mmpp-dwell D1,D2,..]
+//              [--exec exp|pareto|lognormal] [--mean-exec E] [--shape A] [--sigma S]
+//              [--estimate-only]
+// Simulates the periodic tasks of the input file against generated
+// aperiodic arrivals (the A lines are ignored), streamed without a trace
+// file or timeline, and reports aperiodic response-time percentiles per
+// server policy. Every policy sees the same arrivals (same seed). Each
+// policy first gets the queueing-model estimate (QueueingEstimator);
+// --estimate-only stops there. One line per policy each, times in units:
+//   ESTIMATE <policy> <load> <mean> <p50> <p90> <p99> <p99.9>     (inf = unstable)
+//   RESULT <policy> <arrivals> <completed> <backlog> <mean> <p50> <p90> <p99> <p99.9> <max> <OK|DEADLINE_MISS>
+// <arrivals> counts the jobs released before the run ended. Jobs still in
+// the backlog then are censored: they count with the time they had waited
+// (horizon - release), so with a backlog the statistics are lower bounds.
+
+static std::vector<double> parseList(const std::string& text) {
+    std::vector<double> values;
+    std::stringstream ss(text);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) values.push_back(std::atof(item.c_str()));
+    }
+    return values;
+}
+
+static int runWorkload(const CommandLine& cli) {
+    std::string out = cli.get("--workload");
+    if (out.compare(0, 2, "--") == 0) out.clear();
+    std::string inputPath = cli.get("--input", "../../data/input.txt");
+    AlgorithmKind kind = (AlgorithmKind)std::min(4, std::max(1, cli.getInt("--algorithm", 1)));
+
+    auto input = FileReader::readInputFile(inputPath);
+
+    ArrivalGenerator::Config config;
+    config.arrivals = cli.get("--arrival") == "mmpp" ? ArrivalGenerator::ArrivalModel::MMPP
+                                                      : ArrivalGenerator::ArrivalModel::Poisson;
+    config.rate = cli.getDouble("--rate", config.rate);
+    config.stateRates = parseList(cli.get("--mmpp-rates", "0.2,2"));
+    config.stateDwell = parseList(cli.get("--mmpp-dwell", "200,20"));
+    std::string exec = cli.get("--exec", "exp");
+    config.exec = exec == "pareto"    ? ArrivalGenerator::ExecModel::Pareto
+                : exec == "lognormal" ? ArrivalGenerator::ExecModel::LogNormal
+                                      : ArrivalGenerator::ExecModel::Exponential;
+    config.meanExec = cli.getDouble("--mean-exec", config.meanExec);
+    config.paretoShape = cli.getDouble("--shape", config.paretoShape);
+    config.lognormalSigma = cli.getDouble("--sigma", config.lognormalSigma);
+    config.count = std::atoll(cli.get("--count", std::to_string(config.count)).c_str());
+    config.seed = (uint64_t)cli.getInt("--seed", 1);
+    for (const auto& t : input.periodicTasks) config.firstId = std::max(config.firstId, t.id + 1);
+
+    std::vector<std::string> policies = {cli.get("--policy", input.serverPolicy)};
+    if (policies[0] == "all") policies = {"Poller", "Deferrable", "Background"};
+
+    std::string error;
+    if (!ArrivalGenerator::validate(config, error)) {
+        std::cout << "Error: " << error << std::endl;
+        return 1;
+    }
+
+    std::signal(SIGINT, onCancelSignal);
+    std::signal(SIGTERM, onCancelSignal);
+
+    ArrivalGenerator probe(config);
+    std::cout << "Workload: " << config.count << " arrivals, mean rate " << probe.meanRate()
+              << "/unit, offered load " << probe.offeredLoad() << ", last release "
+              << probe.lastRelease() / 10.0 << ", algorithm " << shortName(kind) << std::endl;
+
+    QueueingEstimator::Workload workload{probe.meanRate() / 10.0, config.meanExec * 10.0,
+                                         probe.execSecondMoment() * 100.0};
+    for (const auto& policy : policies) {
+        auto e = QueueingEstimator::estimate(workload, policy, input.periodicTasks, kind, SERVER_CAPACITY, SERVER_PERIOD);
+        std::cout << "ESTIMATE\t" << policy << "\t" << e.load << "\t" << e.meanResponse / 10.0;
+        for (double p : {0.5, 0.9, 0.99, 0.999}) std::cout << "\t" << e.percentile(p) / 10.0;
+        std::cout << "\n";
+    }
+    std::cout << std::flush;
+    if (cli.has("--estimate-only")) return 0;
+
+    std::ofstream tsv;
+    if (!out.empty()) {
+        tsv.open(out);
+        if (!tsv.is_open()) {
+            std::cout << "Error opening file: " << out << std::endl;
+            return 1;
+        }
+        tsv << "policy\tarrivals\tcompleted\tbacklog\tmean\tp50\tp90\tp99\tp999\tmax\tstatus\n";
+    }
+
+    struct Outcome {
+        std::vector<int> responses; // Sorted, ticks; censored backlog included
+        size_t backlog = 0;
+        bool missed = false;
+        bool cancelled = false;
+    };
+    std::vector<Outcome> outcomes(policies.size());
+
+    // Policies are independent runs: one thread each
+    parallelFor(policies.size(), (int)policies.size(), [&](size_t i) {
+        ArrivalGenerator arrivals(config);
+        ISchedulingAlgorithm* algo = createAlgorithm(kind);
+        Scheduler scheduler(input.periodicTasks, {}, algo, policies[i]);
+        scheduler.setVerbose(false);
+        scheduler.setRecordHistory(false);
+        scheduler.setCancelFlag(&cancelRequested);
+        scheduler.setArrivalStream(&arrivals);
+        scheduler.run();
+
+        // Completed jobs plus the censored backlog, so the tail is not
+        // biased low exactly when the server falls behind
+        outcomes[i].responses = scheduler.aperiodicResponseTimes();
+        std::vector<int> waiting = scheduler.aperiodicBacklogAges();
+        outcomes[i].responses.insert(outcomes[i].responses.end(), waiting.begin(), waiting.end());
+        std::sort(outcomes[i].responses.begin(), outcomes[i].responses.end());
+        outcomes[i].backlog = waiting.size();
+        outcomes[i].missed = scheduler.hasDeadlineMiss();
+        outcomes[i].cancelled = scheduler.wasCancelled();
+        delete algo;
+    });
+
+    for (size_t i = 0; i < policies.size(); i++) {
+        const auto& r = outcomes[i].responses;
+        // Nearest-rank percentile, in units
+        auto pct = [&r](double p) -> double {
+            if (r.empty()) return 0.0;
+            size_t rank = (size_t)std::ceil(p * r.size());
+            return r[std::min(r.size(), std::max<size_t>(1, rank)) - 1] / 10.0;
+        };
+        double mean = 0;
+        for (int v : r) mean += v;
+        mean = r.empty() ? 0.0 : mean / r.size() / 10.0;
+
+        std::ostringstream row;
+        row << policies[i] << "\t" << r.size() << "\t" << r.size() - outcomes[i].backlog << "\t"
+            << outcomes[i].backlog << "\t"
+            << mean << "\t" << pct(0.5) << "\t" << pct(0.9) << "\t" << pct(0.99) << "\t" << pct(0.999) << "\t"
+            << (r.empty() ? 0.0 : r.back() / 10.0) << "\t"
+            << (outcomes[i].cancelled ? "CANCELLED" : outcomes[i].missed ? "DEADLINE_MISS" : "OK");
+        std::cout << "RESULT\t" << row.str() << "\n";
+        if (tsv.is_open()) tsv << row.str() << "\n";
+    }
+    std::cout << std::flush;
+    if (tsv.is_open()) std::cout << "Results saved to " << out << std::endl;
+    return 0;
+}
+
+// --- SERVER BOUNDS (--server-bounds) ---
+// rt_scheduler --server-bounds [--input FILE] [--algorithm 1-4]
+//              [--policy Poller|Deferrable|all] [--sizes E1,E2,..] [--step TICKS]
+//              [--target R] [--threads N]
+// Analytical worst-case response time of a lone aperiodic job of each size
+// (units) under the configured server (SERVER_CAPACITY / SERVER_PERIOD),
+// next to the largest response seen in simulation. The simulation releases
+// the job at every --step ticks of one hyperperiod, once on its own and once
+// right behind a job of Cs that drains the budget. Times in units:
+//   SERVER <policy> <Cs> <Ts> <Rs(Cs)>
+//   BOUND  <policy> <size> <bound> <simulated max> <analysis us>
+//   SIZE   <policy> <size> <min Cs for --target, -1 = none>
+
+// Input-file arrivals with a horizon long enough for the slowest response
+class HorizonArrivalStream : public VectorArrivalStream {
+public:
+    HorizonArrivalStream(std::vector<Task> tasks, int horizon)
+        : VectorArrivalStream(std::move(tasks)), horizon(horizon) {}
+
+    int lastRelease() const override { return horizon; }
+
+private:
+    int horizon;
+};
+
+static int runServerBounds(const CommandLine& cli) {
+    std::string inputPath = cli.get("--input", "../../data/input.txt");
+    AlgorithmKind kind = (AlgorithmKind)std::min(4, std::max(1, cli.getInt("--algorithm", 1)));
+    int threads = std::max(1, cli.getInt("--threads", (int)std::thread::hardware_concurrency()));
+
+    auto input = FileReader::readInputFile(inputPath);
+    if (input.periodicTasks.empty()) {
+        std::cout << "Error: No periodic tasks found in " << inputPath << std::endl;
+        return 1;
+    }
+
+    std::vector<std::string> policies = {cli.get("--policy", input.serverPolicy)};
+    if (policies[0] == "all") policies = {"Poller", "Deferrable"};
+    if (policies[0] != "Poller" && policies[0] != "Deferrable") {
+        std::cout << "Error: --server-bounds needs a Poller or Deferrable policy" << std::endl;
+        return 1;
+    }
+
+    std::vector<int> sizes;
+    for (double e : parseList(cli.get("--sizes", "1,2,5,10"))) {
+        if (e > 0) sizes.push_back(std::max(1, (int)std::round(e * 10)));
+    }
+    // Same capped hyperperiod as the Scheduler's, server included, so the
+    // offsets stay inside the stretch the simulation repeats
+    std::vector<Task> released = input.periodicTasks;
+    released.push_back(Task(SERVER_TASK_ID, TaskType::Periodic, 0, SERVER_CAPACITY, SERVER_PERIOD, SERVER_PERIOD));
+    int hyperperiod = BatchSimulator::hyperperiodOf(released);
+    int step = std::max(1, cli.getInt("--step", std::max(1, hyperperiod / 1000)));
+    double target = cli.getDouble("--target", -1);
+
+    std::cout << "Server bounds: algorithm " << shortName(kind) << ", hyperperiod (Ticks) " << hyperperiod
+              << ", offsets every " << step << " tick(s)" << std::endl;
+
+    for (const auto& policy : policies) {
+        auto server = ServerAnalysis::aperiodicBound(input.periodicTasks, kind, policy, SERVER_CAPACITY,
+                                                     SERVER_CAPACITY, SERVER_PERIOD);
+        std::cout << "SERVER\t" << policy << "\t" << SERVER_CAPACITY / 10.0 << "\t" << SERVER_PERIOD / 10.0
+                  << "\t" << server.serverResponse / 10.0 << "\n";
+
+        for (int work : sizes) {
+            auto start = std::chrono::steady_clock::now();
+            auto bound = ServerAnalysis::aperiodicBound(input.periodicTasks, kind, policy, work,
+                                                        SERVER_CAPACITY, SERVER_PERIOD);
+            long long micros = std::chrono::duration_cast<std::chrono::microseconds>(
+                                   std::chrono::steady_clock::now() - start).count();
+
+            // Enough simulated time for the job to finish even without a bound
+            int horizon = hyperperiod + 2 * std::max(bound.responseTime, (work / SERVER_CAPACITY + 2) * SERVER_PERIOD);
+            std::vector<int> offsets;
+            for (int o = 0; o < hyperperiod; o += step) offsets.push_back(o);
+            std::vector<int> worst(offsets.size() * 2, -1);
+            std::atomic<bool> missed(false);
+
+            parallelFor(worst.size(), threads, [&](size_t i) {
+                int release = offsets[i / 2];
+                bool drained = i % 2 == 1;
+                if (drained && release < SERVER_CAPACITY) return;
+
+                std::vector<Task> jobs;
+                if (drained) jobs.push_back(Task(1000, TaskType::Aperiodic, release - SERVER_CAPACITY, SERVER_CAPACITY, 0, 0));
+                jobs.push_back(Task(1001, TaskType::Aperiodic, release, work, 0, 0));
+                HorizonArrivalStream arrivals(jobs, release + horizon);
+
+                ISchedulingAlgorithm* algo = createAlgorithm(kind);
+                Scheduler scheduler(input.periodicTasks, {}, algo, policy);
+                scheduler.setVerbose(false);
+                scheduler.setRecordHistory(false);
+                scheduler.setArrivalStream(&arrivals);
+                scheduler.run();
+                if (scheduler.hasDeadlineMiss()) missed = true;
+
+                // FIFO service: the measured job completes last. Skip runs
+                // where the draining job was still queued when it arrived,
+                // since that backlog is not part of `work`.
+                const auto& r = scheduler.aperiodicResponseTimes();
+                if (r.size() == jobs.size() && (!drained || r[0] <= SERVER_CAPACITY)) worst[i] = r.back();
+                delete algo;
+            });
+
+            int simulated = worst.empty() ? -1 : *std::max_element(worst.begin(), worst.end());
+            std::cout << "BOUND\t" << policy << "\t" << work / 10.0 << "\t" << bound.responseTime / 10.0 << "\t"
+                      << simulated / 10.0 << "\t" << micros;
+            if (bound.responseTime >= 0 && simulated > bound.responseTime) std::cout << "\tEXCEEDED";
+            if (missed) std::cout << "\tDEADLINE_MISS";
+            std::cout << "\n";
+
+            if (target > 0) {
+                int capacity = ServerAnalysis::minimumCapacity(input.periodicTasks, kind, policy, work,
+                                                               SERVER_PERIOD, (int)std::round(target * 10));
+                std::cout << "SIZE\t" << policy << "\t" << work / 10.0 << "\t"
+                          << (capacity < 0 ? -1.0 : capacity / 10.0) << "\n";
+            }
+        }
+    }
+    std::cout << std::flush;
+    return 0;
+}
+
+// --- PROBABILISTIC RTA (--prta) ---
+// rt_scheduler --prta PROFILE [--input FILE] [--algorithm 1|2] [--points N]
+// Response-time distributions from the execution-time distributions in
+// PROFILE (format in ExecutionProfileReader.h) for the tasks of the input
+// file plus the server, under RM or DM. One line per task, highest
+// priority first, times in units (-1 = only reached past the deadline):
+//   PRTA <task> <deadline> <p50> <p99> <miss probability> <target|-> <OK|VIOLATED|->
+// followed by a summary line with the convolution counts and the time taken.
+
+static int runProbabilisticRTA(const CommandLine& cli) {
+    std::string profilePath = cli.get("--prta");
+    std::string inputPath = cli.get("--input", "../../data/input.txt");
+    AlgorithmKind kind = cli.getInt("--algorithm", 1) == 2 ? AlgorithmKind::DeadlineMonotonic
+                                                           : AlgorithmKind::RateMonotonic;
+    int points = std::max(2, cli.getInt("--points", ProbabilisticRTA::DEFAULT_MAX_POINTS));
+
+    auto profile = ExecutionProfileReader::read(profilePath);
+    if (!profile.opened) {
+        std::cout << "Error opening file: " << profilePath << std::endl;
+        return 1;
+    }
+    auto input = FileReader::readInputFile(inputPath);
+    auto tasks = SchedulabilityAnalysis::withServer(input.periodicTasks, input.serverPolicy);
+    if (tasks.empty()) {
+        std::cout << "Error: No periodic tasks found in " << inputPath << std::endl;
+        return 1;
+    }
+
+    std::string error;
+    if (!ProbabilisticRTA::validate(tasks, error)) {
+        std::cout << "Error: " << error << " (the probabilistic RTA covers D <= T without jitter)" << std::endl;
+        return 1;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    auto results = ProbabilisticRTA::analyse(tasks, kind, profile.profiles, points);
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "Probabilistic RTA: " << profile.profiles.size() << " profile(s), algorithm " << shortName(kind)
+              << ", up to " << points << " points per distribution";
+    if (profile.skippedLines > 0) std::cout << " (" << profile.skippedLines << " malformed line(s) skipped)";
+    std::cout << "\n";
+
+    int convolutions = 0, fftConvolutions = 0;
+    bool violated = false;
+    for (const auto& r : results) {
+        auto units = [](int ticks) { return ticks < 0 ? -1.0 : ticks / 10.0; };
+        std::cout << "PRTA\t" << r.taskId << "\t" << r.deadline / 10.0 << "\t" << units(r.response.quantile(0.5))
+                  << "\t" << units(r.response.quantile(0.99)) << "\t" << r.missProbability() << "\t";
+        if (r.missTarget < 0) std::cout << "-\t-\n";
+        else std::cout << r.missTarget << "\t" << (r.meetsTarget ? "OK" : "VIOLATED") << "\n";
+        convolutions += r.convolutions;
+        fftConvolutions += r.fftConvolutions;
+        if (!r.meetsTarget) violated = true;
+    }
+    std::cout << "Convolutions: " << convolutions << " (" << fftConvolutions << " by FFT), " << ms << " ms"
+              << std::endl;
+    return violated ? 2 : 0;
+}
+
+// --- PWCET FROM MEASUREMENTS (--pwcet) ---
+// rt_scheduler --pwcet FILE[,FILE..] [--task ID] [--exceedance P1,P2,..]
+//              [--block N] [--tail K] [--apply [OUT]] [--input FILE]
+// Fits extreme-value distributions to measured execution times (format in
+// MeasurementReader.h; --task gives the id of single-value lines) and
+// prints the execution time exceeded with each per-job probability, times
+// in units ("-" = not enough samples for that fit):
+//   PWCET <task> <samples> <observed max> <exceedance> <gumbel> <gpd> <pwcet>
+// --apply writes a copy of the input file with the execution time of each
+// measured task set to its pWCET at the first exceedance (rounded up to a
+// tick), to OUT or ../../data/input_pwcet.txt.
+
+static int runPwcet(const CommandLine& cli) {
+    std::vector<std::string> paths;
+    std::stringstream list(cli.get("--pwcet"));
+    for (std::string path; std::getline(list, path, ',');) {
+        if (!path.empty()) paths.push_back(path);
+    }
+    int defaultId = cli.getInt("--task", -1);
+    std::vector<double> exceedances = parseList(cli.get("--exceedance", "1e-9"));
+    int blockSize = std::max(1, cli.getInt("--block", 100));
+    int tailSize = std::max(ExtremeValueFit::MIN_TAIL + 1, cli.getInt("--tail", 1000));
+    if (paths.empty() || exceedances.empty()) {
+        std::cout << "Error: --pwcet needs a measurement file and an exceedance probability" << std::endl;
+        return 1;
+    }
+
+    std::map<int, ExtremeValueFit> fits;
+    for (const auto& path : paths) {
+        auto counts = MeasurementReader::read(path, defaultId, [&](int id, double time) {
+            fits.try_emplace(id, blockSize, (size_t)tailSize).first->second.add(time);
+        });
+        if (!counts.opened) {
+            std::cout << "Error opening file: " << path << std::endl;
+            return 1;
+        }
+        std::cout << "Read " << counts.samples << " sample(s) from " << path;
+        if (counts.skippedLines > 0) std::cout << " (" << counts.skippedLines << " malformed line(s) skipped)";
+        std::cout << "\n";
+    }
+
+    for (const auto& [id, fit] : fits) {
+        auto gumbel = fit.gumbel();
+        auto gpd = fit.gpd();
+        for (double p : exceedances) {
+            std::cout << "PWCET\t" << id << "\t" << fit.count() << "\t" << fit.maximum() << "\t" << p << "\t";
+            if (gumbel.valid) std::cout << gumbel.quantile(p);
+            else std::cout << "-";
+            std::cout << "\t";
+            if (gpd.valid) std::cout << gpd.quantile(p);
+            else std::cout << "-";
+            std::cout << "\t" << fit.pwcet(p) << "\n";
+        }
+    }
+    std::cout << std::flush;
+
+    if (!cli.has("--apply")) return 0;
+    std::string out = cli.get("--apply");
+    if (out.empty() || out.compare(0, 2, "--") == 0) out = "../../data/input_pwcet.txt";
+    std::string inputPath = cli.get("--input", "../../data/input.txt");
+
+    std::ifstream in(inputPath);
+    if (!in.is_open()) {
+        std::cout << "Error opening file: " << inputPath << std::endl;
+        return 1;
+    }
+    std::ostringstream rewritten;
+    int taskId = 1, updated = 0; // Same numbering as FileReader::readInputFile
+    for (std::string line; std::getline(in, line);) {
+        Task task;
+        std::string policy;
+        if (FileReader::parseLine(line, task, policy)) {
+            auto it = fits.find(taskId++);
+            if (it != fits.end()) {
+                // Whole ticks, rounded up
+                double units = std::ceil(it->second.pwcet(exceedances[0]) * 10 - 1e-9) / 10.0;
+                if (FileReader::setComputationTime(line, units)) updated++;
+            }
+        }
+        rewritten << line << "\n";
+    }
+
+    std::ofstream file(out);
+    if (!file.is_open()) {
+        std::cout << "Error opening file: " << out << std::endl;
+        return 1;
+    }
+    file << rewritten.str();
+    std::cout << "Input with " << updated << " pWCET(s) at " << exceedances[0] << " saved to " << out << std::endl;
+    return 0;
+}
+
+// --- KERNEL TRACE IMPORT (--sched-trace) ---
+// rt_scheduler --sched-trace FILE [--threads NAME|PID,..] [--min-jobs N] [--top N]
+//              [--tick-us N] [--algorithm 1-4] [--model [OUT]] [--timeline [OUT]]
+// Rebuilds per-thread jobs from an ftrace / trace-cmd text trace
+// (sched_switch + sched_wakeup, see SchedTraceModel.h), derives a periodic
+// task per selected thread (median release gap, observed maximum
+// execution, deadline = period; one tick = --tick-us microseconds, default
+// 100) and simulates that task set. Threads are the ones named in
+// --threads, else the --top (8) with the most jobs (at least --min-jobs, 3).
+// Times in microseconds:
+//   THREAD  <task> <pid> <comm> <jobs> <period> <max exec> <mean exec>
+//   COMPARE <task> <pid> <comm> <observed mean response> <observed max> <simulated mean> <simulated max>
+// --model writes the derived task set as an input file (default
+// ../../data/trace_model.txt), --timeline the observed and simulated jobs
+// of the simulated window side by side (default ../../data/trace_timeline.tsv).
+
+static int runSchedTrace(const CommandLine& cli) {
+    std::string path = cli.get("--sched-trace");
+    double tickUs = std::max(0.001, cli.getDouble("--tick-us", 100));
+    double tickNs = tickUs * 1000.0;
+    AlgorithmKind kind = (AlgorithmKind)std::min(4, std::max(1, cli.getInt("--algorithm", 1)));
+
+    SchedTraceModel model;
+    auto started = std::chrono::steady_clock::now();
+    auto counts = SchedTraceReader::read(path, [&model](const SchedTraceReader::Event& e) { model.add(e); });
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    if (!counts.opened) {
+        std::cout << "Error opening file: " << path << std::endl;
+        return 1;
+    }
+    std::cout << "Read " << counts.lines << " line(s), " << counts.events << " scheduler event(s) in "
+              << seconds * 1000 << " ms (" << counts.bytes / 1e6 / std::max(seconds, 1e-9) << " MB/s)";
+    if (counts.skipped > 0) std::cout << ", " << counts.skipped << " malformed record(s) skipped";
+    std::cout << "\n";
+
+    // Selection: --threads by comm or pid, else the busiest periodic-looking threads
+    std::vector<const SchedTraceModel::Thread*> selected;
+    std::vector<std::string> wanted;
+    std::stringstream list(cli.get("--threads"));
+    for (std::string name; std::getline(list, name, ',');) {
+        if (!name.empty()) wanted.push_back(name);
+    }
+    for (const auto* thread : model.threads(cli.getInt("--min-jobs", 3))) {
+        if (thread->period() == 0) continue;
+        if (!wanted.empty()) {
+            bool match = std::find(wanted.begin(), wanted.end(), thread->comm) != wanted.end() ||
+                         std::find(wanted.begin(), wanted.end(), std::to_string(thread->pid)) != wanted.end();
+            if (!match) continue;
+        } else if ((int)selected.size() >= cli.getInt("--top", 8)) {
+            break;
+        }
+        selected.push_back(thread);
+    }
+    if (selected.empty()) {
+        std::cout << "Error: No periodic threads found in " << path << std::endl;
+        return 1;
+    }
+
+    // One periodic task per thread, phase taken from its first release
+    std::vector<Task> tasks;
+    for (size_t k = 0; k < selected.size(); k++) {
+        const auto& thread = *selected[k];
+        int period = std::max(1, (int)std::llround(thread.period() / tickNs));
+        int wcet = std::max(1, (int)std::ceil(thread.maxExecution / tickNs - 1e-9));
+        int phase = (int)((uint64_t)((thread.firstRelease - model.firstTimestamp()) / tickNs) % period);
+        tasks.push_back(Task((int)k + 1, TaskType::Periodic, phase, wcet, period, period));
+        std::cout << "THREAD\t" << k + 1 << "\t" << thread.pid << "\t" << thread.comm << "\t" << thread.jobs << "\t"
+                  << thread.period() / 1000.0 << "\t" << thread.maxExecution / 1000.0 << "\t"
+                  << thread.meanExecution() / 1000.0 << "\n";
+    }
+
+    ISchedulingAlgorithm* algo = createAlgorithm(kind);
+    Scheduler scheduler(tasks, {}, algo, "Background");
+    scheduler.setVerbose(false);
+    scheduler.run();
+    bool missed = scheduler.hasDeadlineMiss();
+    delete algo;
+
+    // Simulated jobs: job ids grow with release time, so the k-th id of a
+    // task is its k-th release
+    struct SimJob { int taskId; int start = -1; int finish = -1; };
+    std::map<int, SimJob> simJobs;
+    for (const auto& event : scheduler.history) {
+        if (event.taskId < 1 || event.taskId > (int)tasks.size()) continue;
+        SimJob& job = simJobs.try_emplace(event.jobId, SimJob{event.taskId}).first->second;
+        if (event.type == "Running" && job.start < 0) job.start = event.time;
+        if (event.type == "Finish") job.finish = event.time;
+    }
+    struct SimRow { long long release; int start; int finish; };
+    std::vector<std::vector<SimRow>> simulated(tasks.size());
+    for (const auto& [jobId, job] : simJobs) {
+        const Task& task = tasks[job.taskId - 1];
+        long long release = task.releaseTime + (long long)simulated[job.taskId - 1].size() * task.period;
+        simulated[job.taskId - 1].push_back({release, job.start, job.finish});
+    }
+
+    for (size_t k = 0; k < selected.size(); k++) {
+        double sum = 0, worst = 0;
+        int done = 0;
+        for (const auto& row : simulated[k]) {
+            if (row.finish < 0) continue;
+            double response = (row.finish - row.release) * tickUs;
+            sum += response;
+            worst = std::max(worst, response);
+            done++;
+        }
+        const auto& thread = *selected[k];
+        std::cout << "COMPARE\t" << k + 1 << "\t" << thread.pid << "\t" << thread.comm << "\t"
+                  << thread.meanResponse() / 1000.0 << "\t" << thread.maxResponse / 1000.0 << "\t"
+                  << (done ? sum / done : 0.0) << "\t" << worst << "\n";
+    }
+    std::cout << "Simulated " << scheduler.simulatedTicks() * tickUs / 1000.0 << " ms with " << shortName(kind)
+              << (missed ? ": DEADLINE_MISS" : ": OK") << std::endl;
+
+    if (cli.has("--model")) {
+        std::string out = cli.get("--model");
+        if (out.empty() || out.compare(0, 2, "--") == 0) out = "../../data/trace_model.txt";
+        std::ofstream file(out);
+        if (!file.is_open()) {
+            std::cout << "Error opening file: " << out << std::endl;
+            return 1;
+        }
+        file << "# Derived from " << path << " (1 unit = " << tickUs * 10 << " us)\n";
+        for (size_t k = 0; k < tasks.size(); k++) {
+            file << "# " << selected[k]->comm << " (pid " << selected[k]->pid << ")\n";
+            file << "P " << tasks[k].releaseTime / 10.0 << " " << tasks[k].computationTime / 10.0 << " "
+                 << tasks[k].period / 10.0 << "\n";
+        }
+        std::cout << "Task model saved to " << out << std::endl;
+    }
+
+    if (cli.has("--timeline")) {
+        std::string out = cli.get("--timeline");
+        if (out.empty() || out.compare(0, 2, "--") == 0) out = "../../data/trace_timeline.tsv";
+        std::ofstream file(out);
+        if (!file.is_open()) {
+            std::cout << "Error opening file: " << out << std::endl;
+            return 1;
+        }
+        // Both sides relative to the start of the trace, over the simulated window
+        double window = scheduler.simulatedTicks() * tickUs;
+        file << "source\ttask\trelease_us\tstart_us\tfinish_us\tresponse_us\n";
+        for (size_t k = 0; k < selected.size(); k++) {
+            for (const auto& job : selected[k]->log) {
+                double release = (job.release - model.firstTimestamp()) / 1000.0;
+                if (release >= window) break;
+                file << "trace\t" << k + 1 << "\t" << release << "\t" << (job.start - model.firstTimestamp()) / 1000.0
+                     << "\t" << (job.finish - model.firstTimestamp()) / 1000.0 << "\t"
+                     << (job.finish - job.release) / 1000.0 << "\n";
+            }
+            for (const auto& row : simulated[k]) {
+                if (row.finish < 0) continue;
+                file << "sim\t" << k + 1 << "\t" << row.release * tickUs << "\t" << row.start * tickUs << "\t"
+                     << row.finish * tickUs << "\t" << (row.finish - row.release) * tickUs << "\n";
+            }
+        }
+        std::cout << "Timeline saved to " << out << std::endl;
+    }
+    return 0;
+}
+
+// --- DISTRIBUTED TRANSACTIONS (--distributed) ---
+// rt_scheduler --distributed [FILE] [--threads N] [--seed S] [--horizon UNITS] [--export]
+// Nodes, links and transactions from FILE, default ../../data/distributed.txt
+// (format in TransactionReader.h).
+// Runs the per-node test and the holistic end-to-end analysis, then
+// simulates all nodes together (concurrently, --threads) over the
+// transaction hyperperiod or --horizon. Times in units (-1 = unbounded):
+//   NODE        <node> <algorithm> <utilization> <per-node test OK|FAIL>
+//   STEP        <transaction> <step> <node> <task> <local deadline> <offset> <jitter> <bound>
+//               <simulated release jitter> <simulated max response>
+//   TRANSACTION <transaction> <period> <deadline> <bound> <simulated mean> <simulated max> <OK|UNSCHEDULABLE>
+// Responses count from the transaction release. --export writes each
+// node's schedule to ../../data/output_node<ID>.txt. Exits with 2 when the
+// analysis or the simulation finds a missed end-to-end deadline.
+
+static int runDistributed(const CommandLine& cli) {
+    std::string path = cli.get("--distributed");
+    if (path.empty() || path.compare(0, 2, "--") == 0) path = "../../data/distributed.txt";
+    auto input = TransactionReader::read(path);
+    if (!input.opened) {
+        std::cout << "Error opening file: " << path << std::endl;
+        return 1;
+    }
+    for (const auto& error : input.errors) std::cout << "Error: " << error << std::endl;
+    if (!input.errors.empty()) return 1;
+    const DistributedSystem& system = input.system;
+    if (system.transactions.empty()) {
+        std::cout << "Error: No transactions found in " << path << std::endl;
+        return 1;
+    }
+
+    std::cout << "Distributed system: " << system.nodes.size() << " node(s), " << system.links.size()
+              << " link(s), " << system.transactions.size() << " transaction(s)";
+    if (input.skippedLines > 0) std::cout << " (" << input.skippedLines << " malformed line(s) skipped)";
+    std::cout << "\n";
+
+    for (const auto& node : system.nodes) {
+        std::cout << "NODE\t" << node.id << "\t" << shortName(node.algorithm) << "\t"
+                  << HolisticAnalysis::nodeUtilization(system, node.id) << "\t"
+                  << (HolisticAnalysis::nodeTest(system, node) ? "OK" : "FAIL") << "\n";
+    }
+
+    auto analysis = HolisticAnalysis::analyse(system);
+
+    DistributedSimulator::Config config;
+    config.threads = cli.getInt("--threads", (int)std::max(1u, std::thread::hardware_concurrency()));
+    config.seed = (uint64_t)cli.getInt("--seed", 1);
+    config.horizon = (int)std::llround(cli.getDouble("--horizon", 0) * 10);
+    config.recordHistory = cli.has("--export");
+    DistributedSimulator simulator(system, config);
+    auto start = std::chrono::steady_clock::now();
+    auto sim = simulator.run();
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    auto units = [](int ticks) { return ticks < 0 ? -1.0 : ticks / 10.0; };
+    size_t s = 0;
+    for (size_t i = 0; i < system.transactions.size(); i++) {
+        const Transaction& tr = system.transactions[i];
+        const auto& stats = sim.transactions[i];
+        for (size_t k = 0; k < tr.steps.size(); k++, s++) {
+            const auto& bound = analysis.steps[s];
+            const auto& observed = stats.steps[k];
+            std::cout << "STEP\t" << tr.id << "\t" << k + 1 << "\t" << tr.steps[k].node << "\t" << tr.steps[k].taskId
+                      << "\t" << tr.steps[k].localDeadline / 10.0 << "\t" << bound.offset / 10.0 << "\t"
+                      << bound.jitter / 10.0 << "\t" << units(bound.response) << "\t"
+                      << (observed.minRelease < 0 ? -1.0 : (observed.maxRelease - observed.minRelease) / 10.0)
+                      << "\t" << units(observed.maxResponse) << "\n";
+        }
+        int e2e = analysis.endToEnd[i];
+        std::cout << "TRANSACTION\t" << tr.id << "\t" << tr.period / 10.0 << "\t" << tr.deadline / 10.0 << "\t"
+                  << units(e2e) << "\t" << (stats.completed ? stats.sumResponse / stats.completed / 10.0 : 0.0)
+                  << "\t" << units(stats.maxResponse) << "\t"
+                  << (e2e >= 0 && e2e <= tr.deadline ? "OK" : "UNSCHEDULABLE") << "\n";
+    }
+
+    std::cout << "Holistic analysis: " << (analysis.schedulable ? "schedulable" : "not schedulable") << " after "
+              << analysis.iterations << " iteration(s)\n";
+    std::cout << "Simulated " << sim.ticks / 10.0 << " on " << system.nodes.size() << " node(s), "
+              << sim.threads << " thread(s): " << sim.windows << " window(s), lookahead " << sim.lookahead / 10.0
+              << ", " << sim.messages << " message(s), " << ms << " ms: ";
+    if (sim.deadlineMiss) {
+        std::cout << "DEADLINE_MISS transaction " << sim.missTransaction << " instance " << sim.missInstance
+                  << " at " << sim.missTime / 10.0 << std::endl;
+    } else {
+        std::cout << "OK" << std::endl;
+    }
+
+    if (config.recordHistory) {
+        for (size_t n = 0; n < simulator.nodeCount(); n++) {
+            simulator.node(n).exportToFile("output_node" + std::to_string(system.nodes[n].id) + ".txt");
+        }
+        std::cout << "Node schedules saved to ../../data/output_node<ID>.txt" << std::endl;
+    }
+    return (analysis.schedulable && !sim.deadlineMiss) ? 0 : 2;
+}
+
+// --- MULTIPROCESSOR (--multi) ---
+// rt_scheduler --multi [--input FILE] [--cpus M] [--policy gedf|pd2|llref|all] [--horizon UNITS]
+// rt_scheduler --multi --sweep [--cpus M] [--tasks N] [--sets N] [--umin U] [--umax U]
+//              [--ustep U] [--seed S] [--threads N]
+// Global scheduling on M identical processors (default 2) with global EDF,
+// PD^2 Pfair and LLREF (MultiprocessorSimulator.h). The periodic tasks of
+// the input file run until the first miss or over the hyperperiod; the
+// server, aperiodic tasks, jitter and suspension are ignored. Per policy:
+//   MP <policy> <jobs> <preemptions> <migrations> <context switches>
+//      <preemptions/job> <migrations/job> <max lag> <OK|DEADLINE_MISS> [<task> <time>]
+// --sweep draws implicit-deadline sets (UUniFast-discard, no task above 1)
+// at normalized utilization U/M from --umin to --umax and reports, per
+// bucket and policy, the share of sets without a miss and the overhead.
+// Sets whose WCETs round above M processors are drawn again, so every set
+// is feasible; <actual> is the mean U/M after rounding:
+//   SWEEP <U/M> <actual> <policy> <schedulable> <preemptions/job> <migrations/job> <switches/job>
+// then the mean schedulable share over all buckets, and the part of the
+// gap between global EDF and 1 that each policy recovers:
+//   GAP <policy> <mean schedulable> <recovered>
+// --umax * M must stay below --tasks. A bucket where a set could not be
+// drawn within TaskSetGenerator::MAX_DRAWS is reported instead of SWEEP
+// and left out of the means:
+//   SKIP <U/M> <sets not drawn>
+// Lag and times in units. Exits with 2 when a policy misses a deadline
+// (single run only).
+
+static const std::vector<GlobalPolicy> ALL_GLOBAL_POLICIES = {GlobalPolicy::EDF, GlobalPolicy::PD2,
+                                                              GlobalPolicy::LLREF};
+
+static double perJob(long long count, long long jobs) { return jobs ? (double)count / jobs : 0.0; }
+
+static int runMultiprocessorSweep(const CommandLine& cli, int cpus) {
+    TaskSetGenerator::Config generator;
+    generator.taskCount = cli.getInt("--tasks", 3 * cpus);
+    TaskSetGenerator tasksets(generator);
+    int sets = std::max(1, cli.getInt("--sets", 100));
+    double umin = cli.getDouble("--umin", 0.5), umax = cli.getDouble("--umax", 1.0);
+    double ustep = std::max(0.001, cli.getDouble("--ustep", 0.05));
+    uint64_t seed = (uint64_t)cli.getInt("--seed", 1);
+    int threads = cli.getInt("--threads", (int)std::max(1u, std::thread::hardware_concurrency()));
+
+    std::vector<double> buckets;
+    for (double u = umin; u <= umax + 1e-9; u += ustep) buckets.push_back(u);
+    if (buckets.empty() || generator.taskCount < cpus) {
+        std::cout << "Error: Need --umin <= --umax and at least --cpus tasks" << std::endl;
+        return 1;
+    }
+    // No task above utilization 1: the total has to stay below the task count
+    if (buckets.back() * cpus >= generator.taskCount * generator.maxTaskUtilization) {
+        std::cout << "Error: --umax * --cpus must stay below --tasks (no task above utilization 1)" << std::endl;
+        return 1;
+    }
+
+    const size_t policies = ALL_GLOBAL_POLICIES.size();
+    std::vector<MultiprocessorSimulator::Result> results(buckets.size() * sets * policies);
+    std::vector<char> drawn(buckets.size() * sets, 0);
+    std::vector<double> actual(buckets.size() * sets, 0.0);
+    parallelFor(buckets.size() * sets, threads, [&](size_t item) {
+        CounterRng rng(seed, item);
+        TaskSet set;
+        for (int draw = 0; draw < TaskSetGenerator::MAX_DRAWS && set.empty(); draw++) {
+            set = tasksets.generate(buckets[item / sets] * cpus, rng);
+            if (set.empty()) return; // Every draw discarded
+            // Rounding WCETs to ticks can push the set past M processors,
+            // where even the optimal policies have to miss
+            if (SchedulabilityAnalysis::utilization(set) > cpus + 1e-9) set.clear();
+        }
+        if (set.empty()) return;
+        drawn[item] = 1;
+        actual[item] = SchedulabilityAnalysis::utilization(set) / cpus;
+        MultiprocessorSimulator simulator(set, cpus);
+        for (size_t p = 0; p < policies; p++) results[item * policies + p] = simulator.run(ALL_GLOBAL_POLICIES[p]);
+    });
+
+    std::cout << "Multiprocessor sweep: " << cpus << " processor(s), " << generator.taskCount << " tasks, " << sets
+              << " set(s) per bucket\n";
+    std::vector<double> mean(policies, 0.0);
+    std::vector<int> failed(buckets.size(), 0);
+    for (size_t item = 0; item < drawn.size(); item++) failed[item / sets] += !drawn[item];
+    size_t complete = std::count(failed.begin(), failed.end(), 0);
+    for (size_t b = 0; b < buckets.size(); b++) {
+        if (failed[b] > 0) {
+            std::cout << "SKIP\t" << buckets[b] << "\t" << failed[b] << "\n";
+            continue;
+        }
+        double bucketActual = 0.0;
+        for (int k = 0; k < sets; k++) bucketActual += actual[b * sets + k] / sets;
+        for (size_t p = 0; p < policies; p++) {
+            long long ok = 0, jobs = 0, preemptions = 0, migrations = 0, switches = 0;
+            for (int k = 0; k < sets; k++) {
+                const auto& r = results[(b * sets + k) * policies + p];
+                ok += !r.deadlineMiss;
+                jobs += r.jobs;
+                preemptions += r.preemptions;
+                migrations += r.migrations;
+                switches += r.contextSwitches;
+            }
+            double share = (double)ok / sets;
+            mean[p] += share / complete;
+            std::cout << "SWEEP\t" << buckets[b] << "\t" << bucketActual << "\t" << MultiprocessorSimulator::name(ALL_GLOBAL_POLICIES[p])
+                      << "\t" << share << "\t" << perJob(preemptions, jobs) << "\t" << perJob(migrations, jobs)
+                      << "\t" << perJob(switches, jobs) << "\n";
+        }
+    }
+    double gap = 1.0 - mean[0];
+    for (size_t p = 0; p < policies; p++) {
+        std::cout << "GAP\t" << MultiprocessorSimulator::name(ALL_GLOBAL_POLICIES[p]) << "\t" << mean[p] << "\t"
+                  << (gap > 0 ? (mean[p] - mean[0]) / gap : 0.0) << "\n";
+    }
+    return 0;
+}
+
+static int runMultiprocessor(const CommandLine& cli) {
+    int cpus = std::max(1, cli.getInt("--cpus", 2));
+    if (cli.has("--sweep")) return runMultiprocessorSweep(cli, cpus);
+
+    std::string inputPath = cli.get("--input", "../../data/input.txt");
+    auto input = FileReader::readInputFile(inputPath);
+    if (input.periodicTasks.empty()) {
+        std::cout << "Error: No periodic tasks found in " << inputPath << std::endl;
+        return 1;
+    }
+
+    std::vector<GlobalPolicy> policies = ALL_GLOBAL_POLICIES;
+    std::string policyName = cli.get("--policy", "all");
+    if (policyName != "all") {
+        GlobalPolicy policy;
+        if (!MultiprocessorSimulator::parsePolicy(policyName, policy)) {
+            std::cout << "Error: Unknown policy " << policyName << " (gedf, pd2, llref or all)" << std::endl;
+            return 1;
+        }
+        policies = {policy};
+    }
+
+    MultiprocessorSimulator simulator(input.periodicTasks, cpus);
+    int horizon = (int)std::llround(cli.getDouble("--horizon", 0) * 10);
+    std::cout << "Multiprocessor: " << input.periodicTasks.size() << " periodic task(s) on " << cpus
+              << " processor(s), density " << simulator.density() << "\n";
+
+    bool missed = false;
+    for (GlobalPolicy policy : policies) {
+        auto r = simulator.run(policy, horizon);
+        std::cout << "MP\t" << MultiprocessorSimulator::name(policy) << "\t" << r.jobs << "\t" << r.preemptions
+                  << "\t" << r.migrations << "\t" << r.contextSwitches << "\t" << perJob(r.preemptions, r.jobs)
+                  << "\t" << perJob(r.migrations, r.jobs) << "\t" << r.maxLag / 10.0 << "\t";
+        if (r.deadlineMiss) {
+            std::cout << "DEADLINE_MISS\t" << r.missTask << "\t" << r.missTime / 10.0 << "\n";
+            missed = true;
+        } else {
+            std::cout << "OK\n";
+        }
+    }
+    std::cout.flush();
+    return missed ? 2 : 0;
+}
+
+int main(int argc, char* argv[]) {
+    CommandLine cli(argc, argv);
+    if (cli.has("--experiment")) return runExperiment(cli);
+    if (cli.has("--watch")) return runWatch(cli);
+    if (cli.has("--daemon")) return runDaemon(cli);
+    if (cli.has("--cyclic")) return runCyclic(cli);
+    if (cli.has("--workload")) return runWorkload(cli);
+    if (cli.has("--server-bounds")) return runServerBounds(cli);
+    if (cli.has("--prta")) return runProbabilisticRTA(cli);
+    if (cli.has("--pwcet")) return runPwcet(cli);
+    if (cli.has("--sched-trace")) return runSchedTrace(cli);
+    if (cli.has("--distributed")) return runDistributed(cli);
+    if (cli.has("--multi")) return runMultiprocessor(cli);
 
-int main() {
     std::string inputPath = "../../data/input.txt"; 
     
     auto result = FileReader::readInputFile(inputPath);
 
-    if (result.periodicTasks.empty() && result.aperiodicTasks.empty()) {
+    if (result.periodicTasks.empty() && result.aperiodicTasks.empty() && !cli.has("--arrivals")) {
         std::cout << "Error: No tasks found in " << inputPath << std::endl;
         return 1;
     }
 
+    // --arrivals FILE [--arrival-deadline UNITS]: aperiodic jobs streamed from
+    // a trace instead of the A lines; records without a deadline get the
+    // given relative deadline (none by default). The timeline of a replay is
+    // not recorded, so the exports that need it are skipped.
+    std::unique_ptr<ArrivalTraceReader> trace;
+    if (cli.has("--arrivals")) {
+        int firstId = SERVER_TASK_ID;
+        for (const auto& t : result.periodicTasks) firstId = std::max(firstId, t.id);
+        for (const auto& t : result.aperiodicTasks) firstId = std::max(firstId, t.id);
+        int deadline = (int)std::llround(cli.getDouble("--arrival-deadline", 0) * 10);
+        trace.reset(new ArrivalTraceReader(cli.get("--arrivals"), firstId + 1, std::max(0, deadline)));
+        if (!trace->isOpen()) {
+            std::cout << "Error opening file: " << cli.get("--arrivals") << std::endl;
+            return 1;
+        }
+    }
+
     std::cout << "\n========================================\n";
     std::cout << "  Real-Time Scheduling Simulator\n";
     std::cout << "========================================\n\n";
     
     std::cout << "Loaded Tasks:\n";
     std::cout << "  - Periodic: " << result.periodicTasks.size() << "\n";
-    std::cout << "  - Aperiodic: " << result.aperiodicTasks.size() << "\n";
+    if (trace) {
+        std::cout << "  - Aperiodic: trace " << cli.get("--arrivals") << " (last release "
+                  << trace->lastRelease() / 10.0 << ")\n";
+    } else {
+        std::cout << "  - Aperiodic: " << result.aperiodicTasks.size() << "\n";
+    }
     std::cout << "  - Server Policy: " << result.serverPolicy << "\n\n";
 
     std::cout << "Select Scheduling Algorithm:\n";
@@ -62,13 +1253,65 @@ int main() {
     std::cout << "----------------------------------------\n\n";
 
     Scheduler scheduler(result.periodicTasks, result.aperiodicTasks, algo, result.serverPolicy);
+    if (trace) {
+        scheduler.setArrivalStream(trace.get());
+        scheduler.setRecordHistory(false);
+    }
+    // --jitter first|random [--seed S]: how the release jitter of P / D lines is played out
+    if (cli.has("--jitter")) {
+        std::string mode = cli.get("--jitter");
+        if (mode == "random") {
+            scheduler.setJitter(JitterMode::Random, (uint64_t)cli.getInt("--seed", 1));
+        } else if (!mode.empty() && mode != "first" && mode.compare(0, 2, "--") != 0) {
+            std::cout << "Error: unknown jitter mode " << mode << " (first or random)\n";
+            return 1;
+        }
+    }
+
+    size_t sentEvents = 0;
+    if (cli.has("--progress")) {
+        std::string value = cli.get("--progress");
+        int interval = (!value.empty() && std::isdigit((unsigned char)value[0])) ? std::atoi(value.c_str()) : 100;
+
+        std::signal(SIGINT, onCancelSignal);
+        std::signal(SIGTERM, onCancelSignal);
+        // The algorithm choice is already consumed, the rest of stdin is control input
+        std::thread([]() {
+            std::string line;
+            while (std::getline(std::cin, line)) {
+                if (line.find("cancel") != std::string::npos) { cancelRequested = true; break; }
+            }
+        }).detach();
+
+        scheduler.setCancelFlag(&cancelRequested);
+        scheduler.setProgressCallback([&](const ProgressInfo& info) {
+            streamProgress(scheduler, info, sentEvents);
+        }, interval);
+    }
+
     scheduler.run();
-    
-    std::string outputName = "output.txt";
-    scheduler.exportToFile(outputName);
+    if (trace) {
+        std::cout << "Trace: " << trace->recordCount() << " arrival(s) released, " << trace->outOfOrder()
+                  << " out of order, " << trace->skippedLines() << " malformed line(s) skipped\n";
+        std::cout << "Timeline not recorded for a trace replay, exports skipped\n";
+    } else {
+        std::string outputName = "output.txt";
+        scheduler.exportToFile(outputName);
+        scheduler.exportPyramid("output_lod.bin");
+        if (cli.has("--columnar")) {
+            std::string dir = cli.get("--columnar");
+            if (dir.empty() || dir.compare(0, 2, "--") == 0) dir = "../../data/output_columns";
+            scheduler.exportColumnar(dir);
+        }
+        if (cli.has("--table")) {
+            std::string name = cli.get("--table");
+            if (name.empty() || name.compare(0, 2, "--") == 0) name = "dispatch_table";
+            scheduler.exportDispatchTable(name);
+        }
+    }
 
     std::cout << "\n========================================\n";
-    std::cout << "  Simulation Complete!\n";
+    std::cout << (scheduler.wasCancelled() ? "  Simulation Cancelled!\n" : "  Simulation Complete!\n");
     std::cout << "========================================\n";
 
     delete algo;
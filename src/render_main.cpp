@@ -0,0 +1,138 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <map>
+#include <chrono>
+#include <cstdlib>
+#include <cmath>
+#include "../include/utils/FileReader.h"
+#include "../include/utils/GanttRenderer.h"
+#include "../include/utils/TracePyramid.h"
+#include "../include/utils/CommandLine.h"
+#include "../include/core/Scheduler.h"
+
+// rt_render [--output FILE] [--input FILE] [--lod FILE] [--svg FILE]
+//           [--png FILE] [--width N] [--no-png]
+//
+// Draws the Gantt chart of a finished run without Python. output.txt is
+// streamed line by line; input.txt adds periodic arrivals and deadlines,
+// and output_lod.bin (written by rt_scheduler) adds the server budget.
+
+namespace {
+
+struct OpenSlice {
+    int start;
+    int end;
+    std::string description;
+};
+
+bool isExecution(std::string_view event) {
+    return event == "Running" || event == "BackgroundRun" || event.find("ServerExec") != std::string_view::npos;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    CommandLine cli(argc, argv);
+    std::string outputPath = cli.get("--output", "../../data/output.txt");
+    std::string inputPath = cli.get("--input", "../../data/input.txt");
+    std::string lodPath = cli.get("--lod", "../../data/output_lod.bin");
+    std::string svgPath = cli.get("--svg", "../../data/schedule_chart.svg");
+    std::string pngPath = cli.get("--png", "../../data/schedule_chart.png");
+
+    auto started = std::chrono::steady_clock::now();
+
+    GanttRenderer::Options options;
+    options.width = cli.getInt("--width", options.width);
+    GanttRenderer renderer(options);
+
+    std::ifstream in(outputPath);
+    if (!in.is_open()) {
+        std::cout << "Error opening file: " << outputPath << std::endl;
+        return 1;
+    }
+
+    // --- 1. EXECUTION STREAM ---
+    // Consecutive ticks of a task are merged before they reach the renderer
+    std::map<int, OpenSlice> open;
+    std::string line;
+    size_t lineCount = 0;
+    std::getline(in, line); // Column header
+    std::getline(in, line); // Separator
+
+    while (std::getline(in, line)) {
+        // Time, JobID, TaskID, Description, Event; split in place, no copies
+        std::string_view fields[5];
+        std::string_view rest(line);
+        if (!rest.empty() && rest.back() == '\r') rest.remove_suffix(1);
+        int n = 0;
+        for (; n < 5 && !rest.empty(); n++) {
+            size_t tab = rest.find('\t');
+            fields[n] = rest.substr(0, tab);
+            rest = tab == std::string_view::npos ? std::string_view() : rest.substr(tab + 1);
+        }
+        if (n < 5) continue;
+        lineCount++;
+
+        int tick = (int)std::llround(std::strtod(fields[0].data(), nullptr) * options.ticksPerUnit);
+        int taskId = (int)std::strtol(fields[2].data(), nullptr, 10);
+        std::string_view event = fields[4];
+        renderer.extendTo(tick + 1);
+
+        if (isExecution(event)) {
+            auto it = open.find(taskId);
+            if (it != open.end() && it->second.end == tick && it->second.description == fields[3]) {
+                it->second.end = tick + 1;
+                continue;
+            }
+            if (it != open.end()) renderer.addSlice(taskId, it->second.description, it->second.start, it->second.end);
+            open[taskId] = {tick, tick + 1, std::string(fields[3])};
+        } else if (event == "DEADLINE_MISS") {
+            renderer.addMiss(taskId, tick);
+        } else if (event == "AperiodicArrival") {
+            renderer.addArrival(taskId, tick);
+        }
+    }
+    for (const auto& entry : open) {
+        renderer.addSlice(entry.first, entry.second.description, entry.second.start, entry.second.end);
+    }
+
+    int horizon = renderer.horizon();
+
+    // --- 2. PERIODIC ARRIVALS AND DEADLINES ---
+    auto tasks = FileReader::readInputFile(inputPath);
+    for (const auto& task : tasks.periodicTasks) {
+        if (task.period <= 0) continue;
+        for (long long r = task.releaseTime; r < horizon; r += task.period) {
+            renderer.addArrival(task.id, (int)r);
+            if (r + task.relativeDeadline < horizon) renderer.addDeadline(task.id, (int)(r + task.relativeDeadline));
+        }
+    }
+
+    // --- 3. SERVER BUDGET ---
+    std::vector<int32_t> budget;
+    if (tasks.serverPolicy != "Background" && TracePyramid::readBudget(lodPath, budget)) {
+        for (size_t t = 0; t < budget.size() && (int)t < horizon; t++) {
+            renderer.addBudget((int)t, budget[t], SERVER_CAPACITY);
+        }
+    }
+
+    if (!renderer.writeSvg(svgPath)) {
+        std::cout << "Error opening file: " << svgPath << std::endl;
+        return 1;
+    }
+    std::cout << "Chart saved to " << svgPath << std::endl;
+
+    if (!cli.has("--no-png")) {
+        if (!renderer.writePng(pngPath)) {
+            std::cout << "Error opening file: " << pngPath << std::endl;
+            return 1;
+        }
+        std::cout << "Chart saved to " << pngPath << std::endl;
+    }
+
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started).count();
+    std::cout << "Rendered " << lineCount << " events over " << horizon << " ticks in " << ms << " ms" << std::endl;
+    return 0;
+}
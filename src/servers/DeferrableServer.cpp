@@ -1,6 +1,6 @@
 #include "../../include/servers/DeferrableServer.h"
 
-bool DeferrableServer::run(Job* serverJob, std::vector<Job*>& aperiodicQueue, 
+bool DeferrableServer::run(Job* serverJob, std::deque<Job*>& aperiodicQueue, 
                            std::vector<TimelineEvent>& history, int currentTime) {
     
     if (!aperiodicQueue.empty()) {
@@ -14,7 +14,7 @@ bool DeferrableServer::run(Job* serverJob, std::vector<Job*>& aperiodicQueue,
         if (aJob->remainingExecutionTime <= 0) {
             history.push_back({currentTime + 1, aJob->jobId, aJob->task->id, "AperiodicFinish"});
             delete aJob;
-            aperiodicQueue.erase(aperiodicQueue.begin());
+            aperiodicQueue.pop_front();
         }
         return true;
     } else {
@@ -1,6 +1,6 @@
 #include "../../include/servers/PollingServer.h"
 
-bool PollingServer::run(Job* serverJob, std::vector<Job*>& aperiodicQueue, 
+bool PollingServer::run(Job* serverJob, std::deque<Job*>& aperiodicQueue, 
                         std::vector<TimelineEvent>& history, int currentTime) {
     
     // Rule: Check Aperiodic Queue
@@ -19,7 +19,7 @@ bool PollingServer::run(Job* serverJob, std::vector<Job*>& aperiodicQueue,
         if (aJob->remainingExecutionTime <= 0) {
             history.push_back({currentTime + 1, aJob->jobId, aJob->task->id, "AperiodicFinish"});
             delete aJob;
-            aperiodicQueue.erase(aperiodicQueue.begin());
+            aperiodicQueue.pop_front();
         }
         return true; // We did work
     } else {
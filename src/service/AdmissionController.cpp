@@ -0,0 +1,191 @@
+#include "../../include/service/AdmissionController.h"
+#include "../../include/analysis/SchedulabilityAnalysis.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+
+namespace {
+
+const int SCALE_FACTOR = 10; // Same tick scaling as FileReader
+
+int toTicks(const std::string& units) {
+    return (int)std::round(std::atof(units.c_str()) * SCALE_FACTOR);
+}
+
+double toUnits(int ticks) {
+    return (double)ticks / SCALE_FACTOR;
+}
+
+} // namespace
+
+AdmissionController::AdmissionController(AlgorithmKind kind, const std::string& serverPolicy)
+    : kind(kind), serverPolicy(serverPolicy),
+      fixedPriority(kind == AlgorithmKind::RateMonotonic || kind == AlgorithmKind::DeadlineMonotonic),
+      rta(kind), demandOk(true), nextId(1) {
+    load({});
+}
+
+void AdmissionController::load(const std::vector<Task>& periodicTasks) {
+    taskSet = periodicTasks;
+    for (const auto& t : taskSet) nextId = std::max(nextId, t.id + 1);
+
+    // Same order as SchedulabilityAnalysis: the server follows the tasks
+    rta = IncrementalRTA(kind);
+    if (fixedPriority) {
+        for (const auto& t : SchedulabilityAnalysis::withServer(taskSet, serverPolicy)) rta.addTask(t);
+    }
+    reanalyse();
+}
+
+void AdmissionController::reanalyse() {
+    if (!fixedPriority) demandOk = cache.analyse(taskSet, kind, serverPolicy).schedulable;
+}
+
+bool AdmissionController::schedulable() const {
+    return fixedPriority ? rta.schedulable() : demandOk;
+}
+
+bool AdmissionController::hasTask(int taskId) const {
+    return std::any_of(taskSet.begin(), taskSet.end(), [taskId](const Task& t) { return t.id == taskId; });
+}
+
+double AdmissionController::utilization() const {
+    return SchedulabilityAnalysis::utilization(SchedulabilityAnalysis::withServer(taskSet, serverPolicy));
+}
+
+AdmissionController::Decision AdmissionController::check(const Task& candidate) {
+    Task task = candidate;
+    if (task.id < 0) task.id = nextId;
+
+    Decision decision{false, task.id, -1, {}};
+    if (fixedPriority) {
+        decision.admitted = rta.admits(task, decision.violations, decision.responseTime);
+    } else {
+        std::vector<Task> trial = taskSet;
+        trial.push_back(task);
+        decision.admitted = cache.analyse(trial, kind, serverPolicy).schedulable;
+    }
+    return decision;
+}
+
+AdmissionController::Decision AdmissionController::add(const Task& candidate) {
+    Decision decision = check(candidate);
+    if (!decision.admitted) return decision;
+
+    Task task = candidate;
+    task.id = decision.taskId;
+    taskSet.push_back(task);
+    nextId = std::max(nextId, task.id + 1);
+    if (fixedPriority) rta.addTask(task);
+    else demandOk = true;
+    return decision;
+}
+
+bool AdmissionController::remove(int taskId) {
+    auto it = std::find_if(taskSet.begin(), taskSet.end(), [taskId](const Task& t) { return t.id == taskId; });
+    if (it == taskSet.end()) return false;
+    taskSet.erase(it);
+    if (fixedPriority) rta.removeTask(taskId);
+    reanalyse();
+    return true;
+}
+
+bool AdmissionController::updateWCET(int taskId, int computationTime) {
+    auto it = std::find_if(taskSet.begin(), taskSet.end(), [taskId](const Task& t) { return t.id == taskId; });
+    if (it == taskSet.end()) return false;
+    it->computationTime = computationTime;
+    if (fixedPriority) rta.updateWCET(taskId, computationTime);
+    reanalyse();
+    return true;
+}
+
+void AdmissionController::addSlack(JsonLine& reply) const {
+    double u = utilization();
+    reply.add("ok", true).add("schedulable", schedulable()).add("utilization", u)
+         .add("utilization_slack", 1.0 - u);
+
+    // Per-task slack needs response times, i.e. fixed priorities
+    std::string list = "[";
+    int minSlack = -1;
+    for (const auto& e : rta.entries()) {
+        JsonLine entry;
+        entry.add("id", e.task.id).add("deadline", toUnits(e.task.relativeDeadline));
+        if (e.responseTime >= 0) {
+            int slack = e.task.relativeDeadline - e.responseTime;
+            entry.add("response", toUnits(e.responseTime)).add("slack", toUnits(slack));
+            minSlack = minSlack < 0 ? slack : std::min(minSlack, slack);
+        } else {
+            entry.raw("response", "null").raw("slack", "null");
+        }
+        list += (list.size() > 1 ? "," : "") + entry.str();
+    }
+    reply.raw("tasks", list + "]");
+    if (minSlack >= 0) reply.add("min_slack", toUnits(minSlack));
+}
+
+std::string AdmissionController::handle(const std::string& request) {
+    auto started = std::chrono::steady_clock::now();
+    auto finish = [&](JsonLine& reply) {
+        double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - started).count();
+        return reply.add("elapsed_us", us).str();
+    };
+    auto error = [&](const std::string& message) {
+        JsonLine reply;
+        reply.add("ok", false).add("error", message);
+        return finish(reply);
+    };
+
+    std::map<std::string, std::string> fields;
+    if (!JsonLine::parse(request, fields)) return error("malformed request");
+    std::string op = fields["op"];
+
+    if (op == "check" || op == "add") {
+        if (fields["wcet"].empty() || fields["period"].empty()) return error("wcet and period are required");
+
+        int period = toTicks(fields["period"]);
+        int deadline = fields["deadline"].empty() ? period : toTicks(fields["deadline"]);
+        int id = fields["id"].empty() ? -1 : std::atoi(fields["id"].c_str());
+        Task candidate(id, TaskType::Periodic, toTicks(fields["release"]), toTicks(fields["wcet"]), period, deadline,
+                       toTicks(fields["jitter"]));
+
+        if (candidate.computationTime <= 0 || period <= 0 || deadline <= 0) return error("times must be positive");
+        if (candidate.jitter < 0) return error("jitter must not be negative");
+        if (id >= 0 && hasTask(id)) return error("task id already in use");
+
+        Decision decision = op == "add" ? add(candidate) : check(candidate);
+
+        JsonLine reply;
+        reply.add("ok", true).add("admitted", decision.admitted).add("id", decision.taskId);
+        if (decision.responseTime >= 0) reply.add("response", toUnits(decision.responseTime));
+        std::string violations = "[";
+        for (int v : decision.violations) violations += (violations.size() > 1 ? "," : "") + std::to_string(v);
+        reply.raw("violations", violations + "]");
+        return finish(reply);
+    }
+
+    if (op == "update") {
+        if (fields["id"].empty() || fields["wcet"].empty()) return error("id and wcet are required");
+        int wcet = toTicks(fields["wcet"]);
+        if (wcet <= 0) return error("times must be positive");
+        JsonLine reply;
+        reply.add("ok", true).add("updated", updateWCET(std::atoi(fields["id"].c_str()), wcet))
+             .add("schedulable", schedulable());
+        return finish(reply);
+    }
+
+    if (op == "remove") {
+        if (fields["id"].empty()) return error("id is required");
+        JsonLine reply;
+        reply.add("ok", true).add("removed", remove(std::atoi(fields["id"].c_str())));
+        return finish(reply);
+    }
+
+    if (op == "slack") {
+        JsonLine reply;
+        addSlack(reply);
+        return finish(reply);
+    }
+
+    return error("unknown op '" + op + "'");
+}
@@ -0,0 +1,143 @@
+#include "../../include/service/AdmissionServer.h"
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+AdmissionServer::AdmissionServer(AdmissionController& controller, const std::string& socketPath)
+    : controller(controller), socketPath(socketPath), requests(0) {}
+
+#ifdef _WIN32
+
+bool AdmissionServer::run(const std::atomic<bool>& stop) {
+    (void)stop;
+    std::cout << "Error: the admission service needs Unix domain sockets" << std::endl;
+    return false;
+}
+
+#else
+
+namespace {
+
+// Requests are single lines; anything longer is a broken client
+const size_t MAX_LINE = 64 * 1024;
+
+struct Client {
+    int fd;
+    std::string pending;
+};
+
+bool sendAll(int fd, const std::string& data) {
+    size_t sent = 0;
+    while (sent < data.size()) {
+        ssize_t n = send(fd, data.data() + sent, data.size() - sent, 0);
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            pollfd pfd{fd, POLLOUT, 0};
+            poll(&pfd, 1, 1000);
+            continue;
+        }
+        if (n <= 0) return false;
+        sent += (size_t)n;
+    }
+    return true;
+}
+
+} // namespace
+
+bool AdmissionServer::run(const std::atomic<bool>& stop) {
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    if (socketPath.size() >= sizeof(addr.sun_path)) {
+        std::cout << "Error: socket path too long: " << socketPath << std::endl;
+        return false;
+    }
+    std::strncpy(addr.sun_path, socketPath.c_str(), sizeof(addr.sun_path) - 1);
+
+    // A client that disconnects mid-reply must not kill the service
+    std::signal(SIGPIPE, SIG_IGN);
+
+    int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener < 0) {
+        std::cout << "Error opening socket: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    unlink(socketPath.c_str()); // Stale socket from a previous run
+    if (bind(listener, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0 || listen(listener, 16) < 0) {
+        std::cout << "Error opening socket " << socketPath << ": " << std::strerror(errno) << std::endl;
+        close(listener);
+        return false;
+    }
+    fcntl(listener, F_SETFL, O_NONBLOCK);
+
+    std::vector<Client> clients;
+    char buffer[4096];
+
+    while (!stop) {
+        std::vector<pollfd> fds;
+        fds.push_back({listener, POLLIN, 0});
+        for (const auto& c : clients) fds.push_back({c.fd, POLLIN, 0});
+
+        // Short timeout so the stop flag is noticed
+        if (poll(fds.data(), fds.size(), 200) <= 0) continue;
+
+        if (fds[0].revents & POLLIN) {
+            int fd;
+            while ((fd = accept(listener, nullptr, nullptr)) >= 0) {
+                fcntl(fd, F_SETFL, O_NONBLOCK);
+                clients.push_back({fd, ""});
+            }
+        }
+
+        for (size_t i = 1; i < fds.size(); i++) {
+            if (!(fds[i].revents & (POLLIN | POLLHUP | POLLERR))) continue;
+            Client& client = clients[i - 1];
+
+            // A half-closed client (EOF) still gets answers to the lines it
+            // sent before; only a broken connection drops them
+            bool closed = false, broken = false;
+            ssize_t n;
+            while ((n = recv(client.fd, buffer, sizeof(buffer), 0)) > 0) client.pending.append(buffer, n);
+            if (n == 0) closed = true;
+            else if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) closed = broken = true;
+
+            // Answer every complete line, in order
+            size_t start = 0, newline;
+            while (!broken && (newline = client.pending.find('\n', start)) != std::string::npos) {
+                std::string line = client.pending.substr(start, newline - start);
+                start = newline + 1;
+                if (!line.empty() && line.back() == '\r') line.pop_back();
+                if (line.empty()) continue;
+
+                requests++;
+                if (!sendAll(client.fd, controller.handle(line) + "\n")) closed = broken = true;
+            }
+            client.pending.erase(0, start);
+            if (client.pending.size() > MAX_LINE) closed = true;
+
+            if (closed) {
+                close(client.fd);
+                client.fd = -1;
+            }
+        }
+        clients.erase(std::remove_if(clients.begin(), clients.end(), [](const Client& c) { return c.fd < 0; }),
+                      clients.end());
+    }
+
+    for (const auto& c : clients) close(c.fd);
+    close(listener);
+    unlink(socketPath.c_str());
+    return true;
+}
+
+#endif
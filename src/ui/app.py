@@ -6,6 +6,9 @@ Drag & Drop support, Budget tracking, Modern design
 import tkinter as tk
 from tkinter import ttk, messagebox, scrolledtext, filedialog
 import subprocess
+import threading
+import queue
+import time
 import os
 import sys
 
@@ -14,6 +17,7 @@ SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
 DATA_DIR = os.path.abspath(os.path.join(SCRIPT_DIR, "../../data"))
 INPUT_FILE = os.path.join(DATA_DIR, "input.txt")
 OUTPUT_FILE = os.path.join(DATA_DIR, "output.txt")
+LOD_FILE = os.path.join(DATA_DIR, "output_lod.bin")
 BUILD_DIR = os.path.abspath(os.path.join(SCRIPT_DIR, "../../build"))
 EXE_PATH = os.path.join(BUILD_DIR, "rt_scheduler.exe")
 
@@ -22,12 +26,19 @@ try:
     import matplotlib
     matplotlib.use('TkAgg')
     import matplotlib.pyplot as plt
-    from matplotlib.backends.backend_tkagg import FigureCanvasTkAgg
+    from matplotlib.backends.backend_tkagg import FigureCanvasTkAgg, NavigationToolbar2Tk
     import matplotlib.patches as mpatches
     HAS_MATPLOTLIB = True
 except ImportError:
     HAS_MATPLOTLIB = False
 
+# Multi-resolution timeline reader (needs numpy, which matplotlib pulls in)
+try:
+    from lod import LodTrace
+    HAS_LOD = True
+except ImportError:
+    HAS_LOD = False
+
 # Try to import tkinterdnd2 for drag and drop
 try:
     from tkinterdnd2 import DND_FILES, TkinterDnD
@@ -52,6 +63,16 @@ class Theme:
     PURPLE = "#a855f7"
 
 class ModernSchedulerUI:
+    CHART_COLORS = {
+        "Periodic": Theme.BLUE,
+        "Server(Poller)": Theme.ORANGE,
+        "Server(Deferrable)": Theme.ORANGE,
+        "Aperiodic": Theme.GREEN,
+        "Background": Theme.PURPLE,
+        "Unknown": Theme.TEXT3,
+        "FAILED": Theme.RED
+    }
+
     def __init__(self, root):
         self.root = root
         self.root.title("Real-Time Scheduler")
@@ -61,10 +82,15 @@ class ModernSchedulerUI:
         
         self.algorithm = tk.StringVar(value="1")
         self.current_file = INPUT_FILE
+        self.lod_trace = None
+        self.process = None
+        self.watch_process = None
+        self.live_save_job = None
         
         self._create_ui()
         self._load_input_file()
         self._setup_drag_drop()
+        self.root.protocol("WM_DELETE_WINDOW", self._on_close)
         
     def _setup_drag_drop(self):
         """Setup drag and drop if available"""
@@ -138,6 +164,9 @@ class ModernSchedulerUI:
         self._create_button(right, "OPEN", self._open_file, Theme.BG3, Theme.TEXT).pack(side=tk.LEFT, padx=3)
         self._create_button(right, "SAVE", self._save_input, Theme.BLUE, "#fff").pack(side=tk.LEFT, padx=3)
         self._create_button(right, "RUN", self._run_scheduler, Theme.GREEN, "#fff").pack(side=tk.LEFT, padx=3)
+        self._create_button(right, "STOP", self._stop_scheduler, Theme.RED, "#fff").pack(side=tk.LEFT, padx=3)
+        self.live_button = self._create_button(right, "LIVE", self._toggle_live, Theme.BG3, Theme.TEXT)
+        self.live_button.pack(side=tk.LEFT, padx=3)
         self._create_button(right, "CHART", self._show_chart, Theme.PURPLE, "#fff").pack(side=tk.LEFT, padx=3)
         
     def _create_button(self, parent, text, command, bg, fg):
@@ -192,6 +221,7 @@ A r e (Poller/Deferrable) → With server"""
             selectbackground=Theme.ACCENT2, selectforeground="#fff"
         )
         self.input_text.pack(fill=tk.BOTH, expand=True, padx=2, pady=2)
+        self.input_text.bind("<KeyRelease>", self._schedule_live_save)
         
         # Algorithm selection
         algo_frame = tk.Frame(left, bg=Theme.BG2)
@@ -311,6 +341,10 @@ A 2 1 (Poller)
         self._set_status("Saved to input.txt", Theme.GREEN)
         
     def _run_scheduler(self):
+        if self.process is not None:
+            self._set_status("Scheduler is already running", Theme.ORANGE)
+            return
+            
         self._save_input()
         
         if not os.path.exists(EXE_PATH):
@@ -318,31 +352,238 @@ A 2 1 (Poller)
             return
             
         self._set_status("Running scheduler...", Theme.ORANGE)
-        self.root.update()
         
         try:
-            algo = self.algorithm.get()
-            result = subprocess.run(
-                [EXE_PATH], input=algo + "\n", cwd=BUILD_DIR,
-                capture_output=True, text=True, timeout=30
+            # The simulator streams SLICE/MISS/PROGRESS lines while it runs,
+            # a reader thread forwards them so the UI never blocks on the pipe
+            self.process = subprocess.Popen(
+                [EXE_PATH, "--progress", "200"], cwd=BUILD_DIR,
+                stdin=subprocess.PIPE, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                text=True, bufsize=1
             )
+            self.process.stdin.write(self.algorithm.get() + "\n")
+            self.process.stdin.flush()
+        except Exception as e:
+            self.process = None
+            self._set_status(f"Error: {e}", Theme.RED)
+            return
             
-            self.last_output = result.stdout + result.stderr
+        self.stream = queue.Queue()
+        self.live_tasks = {}
+        self.live_misses = []
+        self.log_lines = []
+        self.last_redraw = 0.0
+        
+        reader = threading.Thread(target=self._read_stream, args=(self.process, self.stream), daemon=True)
+        reader.start()
+        
+        self.tab_var.set("chart")
+        self.root.after(100, self._poll_stream)
+        
+    def _stop_scheduler(self):
+        if self.process is None:
+            return
+        try:
+            self.process.stdin.write("cancel\n")
+            self.process.stdin.flush()
+            self._set_status("Cancelling...", Theme.ORANGE)
+        except (BrokenPipeError, OSError):
+            pass
             
-            if "DEADLINE_MISS" in self.last_output:
-                self._set_status("Completed with DEADLINE MISS!", Theme.RED)
+    @staticmethod
+    def _read_stream(process, stream):
+        for line in process.stdout:
+            stream.put(line)
+        stream.put(None)
+        
+    def _poll_stream(self):
+        finished = False
+        progress = None
+        
+        while True:
+            try:
+                line = self.stream.get_nowait()
+            except queue.Empty:
+                break
+            if line is None:
+                finished = True
+                break
+                
+            parts = line.rstrip("\n").split("\t")
+            if parts[0] == "SLICE" and len(parts) >= 5:
+                self._add_live_slice(parts[1], int(parts[2]), int(parts[3]), parts[4])
+            elif parts[0] == "MISS" and len(parts) >= 3:
+                self.live_misses.append((int(parts[1]) / 10.0, parts[2]))
+                self.live_tasks.setdefault(parts[2], {"intervals": [], "desc": "FAILED"})
+            elif parts[0] == "PROGRESS" and len(parts) >= 5:
+                progress = parts
             else:
-                self._set_status("Completed successfully!", Theme.GREEN)
+                self.log_lines.append(line)
                 
-            # Auto show chart
-            self.tab_var.set("chart")
-            self._show_chart()
+        if finished:
+            self._finish_run()
+            return
+            
+        if progress:
+            tick, horizon = int(progress[1]), max(1, int(progress[2]))
+            text = f"Running... t={tick / 10.0:g} / {horizon / 10.0:g} ({100 * tick // horizon}%)"
+            if int(progress[4]) > 0:
+                text += f" - {progress[4]} deadline miss(es)"
+            self._set_status(text, Theme.ORANGE)
+            
+            # Partial chart, throttled so large runs don't spend their time redrawing
+            now = time.monotonic()
+            if HAS_MATPLOTLIB and self.live_tasks and now - self.last_redraw > 1.0:
+                self.last_redraw = now
+                self._draw_live_chart()
+                
+        self.root.after(100, self._poll_stream)
+        
+    def _add_live_slice(self, task_id, start_tick, end_tick, desc):
+        # Same shape _parse_output builds, in user time units
+        task = self.live_tasks.setdefault(task_id, {"intervals": [], "desc": desc})
+        if "Server" in desc or task["desc"] == "FAILED":
+            task["desc"] = desc
+        start, dur = start_tick / 10.0, (end_tick - start_tick) / 10.0
+        intervals = task["intervals"]
+        if intervals and abs(sum(intervals[-1]) - start) < 0.001:
+            intervals[-1] = (intervals[-1][0], intervals[-1][1] + dur)
+        else:
+            intervals.append((start, dur))
+            
+    def _draw_live_chart(self):
+        for w in self.output_frame.winfo_children():
+            w.destroy()
+        plt.close("all")
+        self._draw_chart(self.live_tasks, self.live_misses)
+        
+    def _finish_run(self):
+        self.process.wait()
+        cancelled = any("Simulation Cancelled" in line for line in self.log_lines)
+        self.process = None
+        self.last_output = "".join(self.log_lines)
+        
+        if cancelled:
+            self._set_status("Cancelled - showing partial schedule", Theme.ORANGE)
+        elif "DEADLINE_MISS" in self.last_output or self.live_misses:
+            self._set_status("Completed with DEADLINE MISS!", Theme.RED)
+        else:
+            self._set_status("Completed successfully!", Theme.GREEN)
+            
+        # Final chart comes from the exported files
+        if HAS_MATPLOTLIB:
+            plt.close("all")
+        self._show_chart()
+            
+    # --- LIVE MODE ---
+    # A long-running "rt_scheduler --watch" re-simulates whenever input.txt
+    # is saved; edits are saved automatically after a short pause and the
+    # chart is refreshed from the atomically replaced output files.
+    
+    def _toggle_live(self):
+        if self.watch_process is not None:
+            self._stop_live()
+            self._set_status("Live mode off", Theme.TEXT2)
+            return
+            
+        if not os.path.exists(EXE_PATH):
+            messagebox.showerror("Error", f"Executable not found:\n{EXE_PATH}\n\nRun build.bat first.")
+            return
             
-        except subprocess.TimeoutExpired:
-            self._set_status("Error: Timeout!", Theme.RED)
+        self._save_input()
+        try:
+            self.watch_process = subprocess.Popen(
+                [EXE_PATH, "--watch", "--algorithm", self.algorithm.get()], cwd=BUILD_DIR,
+                stdin=subprocess.DEVNULL, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                text=True, bufsize=1
+            )
         except Exception as e:
+            self.watch_process = None
             self._set_status(f"Error: {e}", Theme.RED)
+            return
+            
+        self.watch_stream = queue.Queue()
+        self.watch_algorithm = self.algorithm.get()
+        threading.Thread(target=self._read_stream, args=(self.watch_process, self.watch_stream), daemon=True).start()
+        self.live_button.config(text="LIVE ON")
+        self._set_status("Live mode on - edits re-run automatically", Theme.ACCENT)
+        self.tab_var.set("chart")
+        self.root.after(200, self._poll_watch)
+        
+    def _stop_live(self):
+        if self.watch_process is None:
+            return
+        self.watch_process.terminate()
+        self.watch_process = None
+        self.live_button.config(text="LIVE")
+        
+    def _schedule_live_save(self, _event=None):
+        if self.watch_process is None:
+            return
+        if self.live_save_job is not None:
+            self.root.after_cancel(self.live_save_job)
+        self.live_save_job = self.root.after(600, self._live_save)
+        
+    def _live_save(self):
+        self.live_save_job = None
+        if self.watch_process is not None:
+            self._save_input()
+            
+    def _poll_watch(self):
+        if self.watch_process is None:
+            return
+            
+        # Algorithm is fixed per watch process, restart it on change
+        if self.algorithm.get() != self.watch_algorithm:
+            self._stop_live()
+            self._toggle_live()
+            return
+            
+        updated = None
+        estimate = None
+        while True:
+            try:
+                line = self.watch_stream.get_nowait()
+            except queue.Empty:
+                break
+            if line is None:
+                self._stop_live()
+                self._set_status("Live mode stopped", Theme.RED)
+                return
+            parts = line.rstrip("\n").split("\t")
+            if parts[0] == "UPDATED" and len(parts) >= 6:
+                updated = parts
+                estimate = None
+            elif parts[0] == "ESTIMATE" and len(parts) >= 5:
+                estimate = parts
+            elif line.startswith("Error"):
+                self._set_status(line.strip(), Theme.RED)
+                
+        if updated:
+            ms, lines, missed = float(updated[1]), updated[2], updated[4] == "DEADLINE_MISS"
+            text = f"Live: re-ran in {ms:.1f} ms ({lines.split('/')[0]} line(s) reparsed)"
+            if estimate:
+                # Queueing-model aperiodic response (ticks -> units)
+                mean = float(estimate[3])
+                text += (f", est. aperiodic response {mean / 10:.1f} (p99 {float(estimate[4]) / 10:.1f})"
+                         if mean != float("inf") else ", aperiodic load too high for the server")
+            if missed:
+                self._set_status(text + " - DEADLINE MISS!", Theme.RED)
+            else:
+                self._set_status(text, Theme.GREEN)
+            if HAS_MATPLOTLIB:
+                plt.close("all")
+            if self.tab_var.get() == "chart":
+                self._show_chart()
             
+        self.root.after(200, self._poll_watch)
+        
+    def _on_close(self):
+        self._stop_live()
+        if self.process is not None:
+            self.process.kill()
+        self.root.destroy()
+        
     def _show_log(self):
         for w in self.output_frame.winfo_children():
             w.destroy()
@@ -374,6 +615,11 @@ A 2 1 (Poller)
             return
             
         try:
+            if HAS_LOD and LodTrace.is_current(LOD_FILE, OUTPUT_FILE):
+                trace = self._open_lod()
+                if trace.levels and self._has_budget(trace):
+                    self._draw_lod_budget(trace)
+                    return
             budget_data = self._parse_budget()
             if not budget_data:
                 tk.Label(self.output_frame, text="No server budget data found",
@@ -480,6 +726,9 @@ A 2 1 (Poller)
             return
             
         try:
+            if HAS_LOD and LodTrace.is_current(LOD_FILE, OUTPUT_FILE):
+                self._draw_lod_chart(self._open_lod())
+                return
             tasks, misses = self._parse_output()
             if not tasks:
                 tk.Label(self.output_frame, text="No data in output file",
@@ -531,16 +780,167 @@ A 2 1 (Poller)
                     
         return tasks, misses
         
+    def _open_lod(self):
+        """Open the timeline summary, releasing the previous mapping"""
+        if self.lod_trace is not None:
+            try:
+                self.lod_trace.close()
+            except Exception:
+                pass  # Still referenced by an old figure; freed with it
+        self.lod_trace = LodTrace(LOD_FILE)
+        return self.lod_trace
+
+    def _has_budget(self, trace):
+        _, _, records = trace.read(len(trace.levels) - 1, 0, trace.horizon)
+        return len(records) > 0 and records["budget_max"].max() >= 0
+
+    def _style_axes(self, fig, ax):
+        fig.patch.set_facecolor(Theme.BG)
+        ax.set_facecolor(Theme.BG)
+        ax.tick_params(colors=Theme.TEXT2)
+        ax.grid(True, axis='x', linestyle='--', alpha=0.2, color=Theme.TEXT3)
+        for spine in ax.spines.values():
+            spine.set_color(Theme.BG3)
+
+    def _embed_figure(self, fig):
+        canvas = FigureCanvasTkAgg(fig, master=self.output_frame)
+        toolbar = NavigationToolbar2Tk(canvas, self.output_frame, pack_toolbar=False)
+        toolbar.update()
+        toolbar.pack(side=tk.BOTTOM, fill=tk.X)
+        canvas.get_tk_widget().pack(fill=tk.BOTH, expand=True)
+        return canvas
+
+    def _draw_lod_chart(self, trace):
+        """Gantt chart from the timeline summary.
+
+        Only buckets of the level matching the visible range are drawn; every
+        zoom or pan re-reads that slice, so wide views of long traces stay fast.
+        """
+        fig, ax = plt.subplots(figsize=(9, 5))
+        self._style_axes(fig, ax)
+        tpu = float(trace.ticks_per_unit)
+
+        order = sorted(range(len(trace.lanes)), key=lambda i: trace.lanes[i][0])
+        lane_y = {}
+        y_labels = []
+        y_ticks = []
+        patches = []
+        seen = set()
+        for idx, lane in enumerate(order):
+            task_id, desc = trace.lanes[lane]
+            lane_y[lane] = idx * 10
+            y_labels.append(f"{desc} (T{task_id})")
+            y_ticks.append(idx * 10 + 4)
+            if desc not in seen:
+                seen.add(desc)
+                patches.append(mpatches.Patch(color=self._lane_color(desc), label=desc))
+
+        artists = []
+
+        def render(_ax=None):
+            for a in artists:
+                a.remove()
+            artists.clear()
+
+            x0, x1 = ax.get_xlim()
+            t0, t1 = max(0, int(x0 * tpu)), min(trace.horizon, int(x1 * tpu) + 1)
+            level = trace.level_for(t0, t1, max(100, int(ax.bbox.width)))
+            starts, bucket, records = trace.read(level, t0, t1)
+            if len(records) == 0:
+                return
+
+            for lane, y in lane_y.items():
+                busy = records["busy"][:, lane]
+                mask = busy > 0
+                if not mask.any():
+                    continue
+                # Bar height = busy fraction of the bucket
+                artists.append(ax.bar(starts[mask] / tpu, busy[mask] * 8, width=bucket / tpu,
+                                      bottom=y, align='edge', linewidth=0,
+                                      color=self._lane_color(trace.lanes[lane][1])))
+
+            miss_x = starts[records["misses"] > 0] / tpu
+            if len(miss_x):
+                artists.append(ax.vlines(miss_x, -5, len(order) * 10 + 5, colors=Theme.RED,
+                                         linestyles='--', linewidth=2, alpha=0.8))
+
+            ax.set_title(f'Gantt Chart - Task Execution Timeline ({bucket / tpu:g} per bucket)',
+                         color=Theme.ACCENT, fontsize=12, fontweight='bold')
+            fig.canvas.draw_idle()
+
+        if order:
+            ax.set_ylim(-5, len(order) * 10 + 5)
+        ax.set_xlim(0, trace.horizon / tpu)
+        ax.set_yticks(y_ticks)
+        ax.set_yticklabels(y_labels, color=Theme.TEXT, fontsize=9)
+        ax.set_xlabel('Time', color=Theme.TEXT, fontsize=10)
+
+        if any(trace.read(len(trace.levels) - 1, 0, trace.horizon)[2]["misses"] > 0):
+            patches.append(mpatches.Patch(color=Theme.RED, label='DEADLINE MISS'))
+        if patches:
+            legend = ax.legend(handles=patches, loc='upper right', facecolor=Theme.BG2, edgecolor=Theme.BG3)
+            for text in legend.get_texts():
+                text.set_color(Theme.TEXT)
+
+        plt.tight_layout()
+        canvas = self._embed_figure(fig)
+        render()
+        ax.callbacks.connect('xlim_changed', render)
+        canvas.draw()
+
+    def _draw_lod_budget(self, trace):
+        """Server budget band (min/max per bucket) from the timeline summary"""
+        fig, ax = plt.subplots(figsize=(8, 4))
+        self._style_axes(fig, ax)
+        tpu = float(trace.ticks_per_unit)
+        artists = []
+
+        def render(_ax=None):
+            for a in artists:
+                a.remove()
+            artists.clear()
+
+            x0, x1 = ax.get_xlim()
+            t0, t1 = max(0, int(x0 * tpu)), min(trace.horizon, int(x1 * tpu) + 1)
+            level = trace.level_for(t0, t1, max(100, int(ax.bbox.width)))
+            starts, bucket, records = trace.read(level, t0, t1)
+            if len(records) == 0:
+                return
+
+            xs = starts / tpu
+            lo = records["budget_min"] / tpu
+            hi = records["budget_max"] / tpu
+            artists.append(ax.fill_between(xs, lo, hi, step='post', alpha=0.3, color=Theme.ACCENT))
+            artists.extend(ax.step(xs, hi, where='post', color=Theme.ACCENT, linewidth=1.5))
+            fig.canvas.draw_idle()
+
+        _, _, whole = trace.read(len(trace.levels) - 1, 0, trace.horizon)
+        capacity = whole["budget_max"].max() / tpu
+        ax.axhline(y=capacity, color=Theme.ORANGE, linestyle='--', linewidth=1, label=f'Capacity ({capacity:g})')
+        ax.axhline(y=0, color=Theme.RED, linestyle='--', linewidth=1, alpha=0.5)
+        ax.set_xlim(0, trace.horizon / tpu)
+        ax.set_ylim(-0.2, capacity + 0.5)
+        ax.set_xlabel('Time', color=Theme.TEXT, fontsize=10)
+        ax.set_ylabel('Server Budget', color=Theme.TEXT, fontsize=10)
+        ax.set_title('Server Budget Consumption', color=Theme.ACCENT, fontsize=12, fontweight='bold')
+
+        legend = ax.legend(loc='upper right', facecolor=Theme.BG2, edgecolor=Theme.BG3)
+        for text in legend.get_texts():
+            text.set_color(Theme.TEXT)
+
+        plt.tight_layout()
+        canvas = self._embed_figure(fig)
+        render()
+        ax.callbacks.connect('xlim_changed', render)
+        canvas.draw()
+
+    def _lane_color(self, desc):
+        if "Server" in desc:
+            return Theme.ORANGE
+        return self.CHART_COLORS.get(desc, Theme.TEXT3)
+
     def _draw_chart(self, tasks, misses):
-        colors = {
-            "Periodic": Theme.BLUE,
-            "Server(Poller)": Theme.ORANGE,
-            "Server(Deferrable)": Theme.ORANGE,
-            "Aperiodic": Theme.GREEN,
-            "Background": Theme.PURPLE,
-            "Unknown": Theme.TEXT3,
-            "FAILED": Theme.RED
-        }
+        colors = self.CHART_COLORS
         
         fig, ax = plt.subplots(figsize=(9, 5))
         fig.patch.set_facecolor(Theme.BG)
@@ -0,0 +1,90 @@
+"""
+Reader for the multi-resolution timeline summary (data/output_lod.bin)
+written by Scheduler::exportPyramid. See include/utils/TracePyramid.h
+for the layout.
+
+Level k holds 2^k ticks per bucket. Viewers ask for the level whose bucket
+count over the visible range fits the screen, then read only that slice,
+so drawing cost depends on the plot width instead of the trace length.
+"""
+
+import mmap
+import os
+import struct
+
+import numpy as np
+
+MAGIC = b"RTLOD1\0\0"
+
+
+class LodTrace:
+    def __init__(self, path):
+        self.path = path
+        self._file = open(path, "rb")
+        self._map = mmap.mmap(self._file.fileno(), 0, access=mmap.ACCESS_READ)
+
+        if self._map[:8] != MAGIC:
+            raise ValueError(f"{path} is not a timeline summary")
+
+        level_count, lane_count, self.horizon, self.ticks_per_unit = struct.unpack_from("<4I", self._map, 8)
+        pos = 24
+
+        # (task id, description) per lane, in file order
+        self.lanes = []
+        for _ in range(lane_count):
+            task_id, name_len = struct.unpack_from("<iH", self._map, pos)
+            pos += 6
+            name = self._map[pos:pos + name_len].decode("utf-8", "replace")
+            pos += name_len
+            self.lanes.append((task_id, name))
+
+        # (bucket ticks, bucket count, offset) per level, finest first
+        self.levels = []
+        for _ in range(level_count):
+            self.levels.append(struct.unpack_from("<IIQ", self._map, pos))
+            pos += 16
+
+        self._dtype = np.dtype([
+            ("busy", "<f4", (lane_count,)),
+            ("misses", "<u4"),
+            ("budget_min", "<i4"),
+            ("budget_max", "<i4"),
+        ])
+
+    @staticmethod
+    def is_current(lod_path, output_path):
+        """True if the summary exists and is not older than output.txt."""
+        if not os.path.exists(lod_path):
+            return False
+        if not os.path.exists(output_path):
+            return True
+        return os.path.getmtime(lod_path) >= os.path.getmtime(output_path)
+
+    def close(self):
+        self._map.close()
+        self._file.close()
+
+    def level_for(self, t0, t1, max_buckets):
+        """Finest level showing ticks [t0, t1) in at most max_buckets buckets."""
+        span = max(1, t1 - t0)
+        for k, (bucket_ticks, _, _) in enumerate(self.levels):
+            if span / bucket_ticks <= max_buckets:
+                return k
+        return len(self.levels) - 1
+
+    def read(self, level, t0, t1):
+        """Buckets of `level` overlapping ticks [t0, t1).
+
+        Returns (start ticks, bucket ticks, records) where records is a
+        numpy structured array viewing the mapped file (no copy).
+        """
+        bucket_ticks, count, offset = self.levels[level]
+        first = max(0, int(t0) // bucket_ticks)
+        last = min(count, -(-int(t1) // bucket_ticks))
+        if last <= first:
+            return np.zeros(0), bucket_ticks, np.zeros(0, dtype=self._dtype)
+
+        records = np.frombuffer(self._map, dtype=self._dtype, count=last - first,
+                                offset=offset + first * self._dtype.itemsize)
+        starts = np.arange(first, last) * bucket_ticks
+        return starts, bucket_ticks, records
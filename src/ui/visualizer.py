@@ -8,6 +8,15 @@ script_dir = os.path.dirname(os.path.abspath(__file__))
 DATA_FILE = os.path.abspath(os.path.join(script_dir, "../../data/output.txt"))
 CONFIG_FILE = os.path.abspath(os.path.join(script_dir, "../../data/input.txt"))
 OUTPUT_IMAGE = os.path.abspath(os.path.join(script_dir, "../../data/schedule_chart.png"))
+LOD_FILE = os.path.abspath(os.path.join(script_dir, "../../data/output_lod.bin"))
+
+# Multi-resolution timeline reader (optional, needs numpy)
+sys.path.insert(0, script_dir)
+try:
+    from lod import LodTrace
+    HAS_LOD = True
+except ImportError:
+    HAS_LOD = False
 
 # Colors
 COLORS = {
@@ -152,9 +161,66 @@ def plot_gantt(tasks, misses, policy_name):
     plt.tight_layout()
     plt.savefig(OUTPUT_IMAGE)
 
+def plot_gantt_lod(trace, policy_name):
+    """Same chart from the timeline summary: one bar per bucket of the level
+    that fits the figure width, instead of one per merged interval."""
+    fig, ax = plt.subplots(figsize=(12, 6))
+    tpu = float(trace.ticks_per_unit)
+
+    width_px = int(fig.get_figwidth() * fig.dpi)
+    level = trace.level_for(0, trace.horizon, width_px)
+    starts, bucket, records = trace.read(level, 0, trace.horizon)
+
+    # Sort: Server (ID 999) at the top
+    order = sorted(range(len(trace.lanes)), key=lambda i: trace.lanes[i][0])
+    y_labels = []
+    y_ticks = []
+    seen_types = set()
+
+    for i, lane in enumerate(order):
+        task_id, desc = trace.lanes[lane]
+        seen_types.add(desc)
+        color = COLORS.get(desc, "tab:gray")
+        if "Server" in desc: color = COLORS["Server"]
+
+        busy = records["busy"][:, lane]
+        mask = busy > 0
+        ax.bar(starts[mask] / tpu, busy[mask] * 9, width=bucket / tpu, bottom=i * 10,
+               align='edge', color=color, linewidth=0)
+
+        y_labels.append(f"{desc}\n(ID: {task_id})")
+        y_ticks.append(i * 10 + 4.5)
+
+    misses = starts[records["misses"] > 0] / tpu
+    for time in misses:
+        ax.axvline(x=time, color='red', linestyle='--', linewidth=2, alpha=0.8)
+
+    ax.set_ylim(0, len(order) * 10 + 10)
+    ax.set_xlim(0, trace.horizon / tpu + 0.5)
+    ax.set_xlabel('Time (Seconds)')
+    ax.set_yticks(y_ticks)
+    ax.set_yticklabels(y_labels)
+    ax.grid(True, axis='x', linestyle='--', alpha=0.7)
+
+    patches = []
+    for desc_type in sorted(seen_types):
+        c = COLORS.get(desc_type, "tab:gray")
+        if "Server" in desc_type: c = COLORS["Server"]
+        patches.append(mpatches.Patch(color=c, label=desc_type))
+    if len(misses): patches.append(mpatches.Patch(color='red', label='DEADLINE MISS'))
+
+    plt.legend(handles=patches, loc='upper right')
+    plt.title(f'Real-Time Schedule Execution\nMode: {policy_name}')
+    plt.tight_layout()
+    plt.savefig(OUTPUT_IMAGE)
+
 if __name__ == "__main__":
     print("Generating Chart...")
     policy = detect_input_policy(CONFIG_FILE)
+    if HAS_LOD and LodTrace.is_current(LOD_FILE, DATA_FILE):
+        plot_gantt_lod(LodTrace(LOD_FILE), policy)
+        print(f"Done. Saved to {OUTPUT_IMAGE}")
+        sys.exit(0)
     tasks, misses = parse_data(DATA_FILE)
     if tasks:
         plot_gantt(tasks, misses, policy)
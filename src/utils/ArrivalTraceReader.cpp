@@ -0,0 +1,89 @@
+#include "../../include/utils/ArrivalTraceReader.h"
+#include <cmath>
+#include <climits>
+#include <cstdlib>
+
+namespace {
+
+const int SCALE_FACTOR = 10; // Same scaling as FileReader
+
+bool isBlankOrComment(const std::string& line) {
+    for (char c : line) {
+        if (c == '#') return true;
+        if (c != ' ' && c != '\t' && c != '\r') return false;
+    }
+    return true;
+}
+
+// Units -> ticks; false if the value doesn't fit in an int tick count
+bool toTicks(double units, int& ticks) {
+    double scaled = std::round(units * SCALE_FACTOR);
+    if (!std::isfinite(scaled) || scaled > INT_MAX || scaled < INT_MIN) return false;
+    ticks = (int)scaled;
+    return true;
+}
+
+} // namespace
+
+ArrivalTraceReader::ArrivalTraceReader(const std::string& path, int firstId, int defaultDeadline)
+    : file(path), nextId(firstId), defaultDeadline(defaultDeadline), last(-1), previous(0),
+      records(0), reordered(0), skipped(0) {
+    if (file.is_open()) last = findLastRelease(path, defaultDeadline);
+}
+
+bool ArrivalTraceReader::parseRecord(const std::string& line, int defaultDeadline, Task& task) {
+    const char* p = line.c_str();
+    while (*p == ' ' || *p == '\t') p++;
+    if (*p == 'A' || *p == 'a') p++;
+
+    double values[3] = {0, 0, 0};
+    int count = 0;
+    while (count < 3) {
+        while (*p == ' ' || *p == '\t' || *p == ',') p++;
+        if (*p == '\0' || *p == '#' || *p == '\r') break;
+        char* end = nullptr;
+        double v = std::strtod(p, &end);
+        if (end == p) return false;
+        values[count++] = v;
+        p = end;
+    }
+    if (count < 2 || values[0] < 0 || values[1] <= 0) return false;
+
+    int r = 0, e = 0, d = defaultDeadline;
+    if (!toTicks(values[0], r) || !toTicks(values[1], e)) return false;
+    if (count == 3 && (!toTicks(values[2], d) || d < 0)) return false;
+
+    task = Task(-1, TaskType::Aperiodic, r, e, 0, d);
+    return true;
+}
+
+bool ArrivalTraceReader::next(Task& task) {
+    while (std::getline(file, line)) {
+        if (isBlankOrComment(line)) continue;
+        if (!parseRecord(line, defaultDeadline, task)) { skipped++; continue; }
+
+        if (task.releaseTime < previous) {
+            task.releaseTime = previous;
+            reordered++;
+        }
+        previous = task.releaseTime;
+        task.id = nextId++;
+        records++;
+        return true;
+    }
+    return false;
+}
+
+int ArrivalTraceReader::findLastRelease(const std::string& path, int defaultDeadline) {
+    // The stream clamps late records to the running maximum, so the run has
+    // to cover the latest release anywhere in the file, not the last record's
+    std::ifstream in(path);
+    std::string text;
+    int latest = -1;
+    while (std::getline(in, text)) {
+        Task task;
+        if (isBlankOrComment(text) || !parseRecord(text, defaultDeadline, task)) continue;
+        if (task.releaseTime > latest) latest = task.releaseTime;
+    }
+    return latest;
+}
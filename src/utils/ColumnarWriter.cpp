@@ -0,0 +1,109 @@
+#include "../../include/utils/ColumnarWriter.h"
+#include <filesystem>
+#include <iostream>
+
+namespace {
+
+// Total header size (magic + version + length + dict). A multiple of 64 as
+// the format requires, with room for any 64-bit row count.
+const size_t NPY_HEADER_SIZE = 128;
+
+const char* descrOf(ColumnarWriter::Type type) {
+    switch (type) {
+        case ColumnarWriter::Type::UInt8: return "|u1";
+        case ColumnarWriter::Type::Int32: return "<i4";
+        case ColumnarWriter::Type::Int64: return "<i8";
+        default:                          return "<f8";
+    }
+}
+
+} // namespace
+
+ColumnarWriter::ColumnarWriter(const std::string& directory)
+    : directory(directory), ok(true), closed(false) {
+    std::error_code ec;
+    std::filesystem::create_directories(directory, ec);
+    if (ec) {
+        std::cout << "Error creating directory: " << directory << std::endl;
+        ok = false;
+    }
+}
+
+ColumnarWriter::~ColumnarWriter() {
+    close();
+    for (Column* c : columns) delete c;
+}
+
+void ColumnarWriter::writeHeader(std::ofstream& out, Type type, uint64_t rows) {
+    std::string dict = std::string("{'descr': '") + descrOf(type) +
+                       "', 'fortran_order': False, 'shape': (" + std::to_string(rows) + ",), }";
+    // magic(6) + version(2) + header length(2) = 10 bytes before the dict
+    size_t dictLen = NPY_HEADER_SIZE - 10;
+    dict.resize(dictLen - 1, ' ');
+    dict += '\n';
+
+    uint16_t len = (uint16_t)dictLen;
+    out.seekp(0);
+    out.write("\x93NUMPY\x01\x00", 8);
+    out.put((char)(len & 0xFF));
+    out.put((char)(len >> 8));
+    out.write(dict.data(), dict.size());
+}
+
+int ColumnarWriter::addColumn(const std::string& name, Type type) {
+    Column* c = new Column{name, type, std::ofstream(), 0};
+    c->file.open(directory + "/" + name + ".npy", std::ios::binary | std::ios::trunc);
+    if (!c->file.is_open()) ok = false;
+    else writeHeader(c->file, type, 0);
+    columns.push_back(c);
+    return (int)columns.size() - 1;
+}
+
+void ColumnarWriter::append(int column, double value) {
+    Column* c = columns[column];
+    // The format is little-endian; every platform we build for is too
+    switch (c->type) {
+        case Type::UInt8: {
+            uint8_t v = (uint8_t)value;
+            c->file.write(reinterpret_cast<const char*>(&v), sizeof(v));
+            break;
+        }
+        case Type::Int32: {
+            int32_t v = (int32_t)value;
+            c->file.write(reinterpret_cast<const char*>(&v), sizeof(v));
+            break;
+        }
+        case Type::Int64: {
+            int64_t v = (int64_t)value;
+            c->file.write(reinterpret_cast<const char*>(&v), sizeof(v));
+            break;
+        }
+        case Type::Float64: {
+            c->file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+            break;
+        }
+    }
+    c->rows++;
+}
+
+void ColumnarWriter::addNote(const std::string& key, const std::string& value) {
+    notes.push_back({key, value});
+}
+
+void ColumnarWriter::close() {
+    if (closed) return;
+    closed = true;
+
+    for (Column* c : columns) {
+        if (!c->file.is_open()) continue;
+        writeHeader(c->file, c->type, c->rows);
+        c->file.close();
+    }
+
+    std::ofstream schema(directory + "/schema.tsv");
+    schema << "Column\tDtype\tRows\tFile\n";
+    for (Column* c : columns) {
+        schema << c->name << "\t" << descrOf(c->type) << "\t" << c->rows << "\t" << c->name << ".npy\n";
+    }
+    for (const auto& n : notes) schema << "#" << n.first << "\t" << n.second << "\n";
+}
@@ -0,0 +1,53 @@
+#include "../../include/utils/ExecutionProfileReader.h"
+#include <fstream>
+#include <sstream>
+#include <cmath>
+#include <algorithm>
+#include <cstdlib>
+
+namespace {
+
+const int SCALE_FACTOR = 10; // Same scaling as FileReader
+
+} // namespace
+
+ExecutionProfileReader::Result ExecutionProfileReader::read(const std::string& path) {
+    Result result;
+    std::ifstream file(path);
+    if (!file.is_open()) return result;
+    result.opened = true;
+
+    std::map<int, std::map<int, double>> mass;
+    std::string line;
+    while (std::getline(file, line)) {
+        line = line.substr(0, line.find('#'));
+        std::replace(line.begin(), line.end(), ',', ' ');
+        std::stringstream ss(line);
+        std::string idText, valueText;
+        double probability = 0;
+        if (!(ss >> idText)) continue; // Blank or comment
+        if (!(ss >> valueText >> probability) || probability < 0) { result.skippedLines++; continue; }
+
+        int id = std::atoi(idText.c_str());
+        if (valueText == "miss") {
+            result.profiles[id].missTarget = probability;
+            continue;
+        }
+        double value = std::atof(valueText.c_str());
+        if (value <= 0) { result.skippedLines++; continue; }
+        // Rounded up: the analysis stays on the safe side of the measurement
+        int ticks = (int)std::ceil(value * SCALE_FACTOR - 1e-9);
+        mass[id][ticks] += probability;
+    }
+
+    for (const auto& [id, points] : mass) {
+        double total = 0;
+        for (const auto& [ticks, p] : points) total += p;
+        if (total <= 0) continue;
+        auto& profile = result.profiles[id];
+        for (const auto& [ticks, p] : points) {
+            if (p > 0) profile.points.push_back({ticks, p / total});
+        }
+    }
+    return result;
+}
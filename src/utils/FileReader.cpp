@@ -3,113 +3,231 @@
 #include <sstream>
 #include <iostream>
 #include <cmath> // for round
+#include <algorithm>
+#include <cstdlib>
 
 // --- CONFIG ---
 const int SCALE_FACTOR = 10; // 1 unit = 10 ticks (0.1 resolution)
 
-FileReader::ParseResult FileReader::readInputFile(const std::string& filename) {
-    ParseResult result;
-    result.serverPolicy = "Background"; 
+bool FileReader::parseLine(const std::string& line, Task& task, std::string& policy) {
+    policy.clear();
+    if (line.empty() || line[0] == '#') return false;
+
+    std::stringstream ss(line);
+    char typeChar;
+    ss >> typeChar;
+
+    // D is also Periodic, just with explicit deadline
+    TaskType type = TaskType::Periodic;
+    bool hasExplicitDeadline = false;
     
-    std::ifstream file(filename);
-    if (!file.is_open()) {
-        std::cerr << "Error: Could not open file " << filename << std::endl;
-        return result;
+    if (typeChar == 'P') {
+        type = TaskType::Periodic;
+        hasExplicitDeadline = false;
+    }
+    else if (typeChar == 'D') {
+        type = TaskType::Periodic;  // D is also periodic!
+        hasExplicitDeadline = true;
     }
+    else if (typeChar == 'A') {
+        type = TaskType::Aperiodic;
+    }
+    else return false;
 
-    std::string line;
-    int taskIdCounter = 1;
+    std::vector<double> rawNumbers;
+    double num;
+    while (ss >> num) rawNumbers.push_back(num);
+    
+    // Check Policy Tags for Aperiodic tasks
+    if (type == TaskType::Aperiodic) {
+        ss.clear();
+        std::string remaining;
+        std::getline(ss, remaining);
+        if (remaining.find("Poller") != std::string::npos) policy = "Poller";
+        else if (remaining.find("Deferrable") != std::string::npos) policy = "Deferrable";
+    }
 
-    while (std::getline(file, line)) {
-        if (line.empty() || line[0] == '#') continue;
+    // Optional tags after the numbers of a P/D line, in any order:
+    // "jitter J" and "segments E S E ..."
+    double j_d = 0;
+    std::vector<double> segments;
+    if (type != TaskType::Aperiodic) {
+        ss.clear();
+        std::string tag;
+        while (ss >> tag) {
+            if (tag == "jitter") {
+                if (!(ss >> j_d)) j_d = 0;
+            } else if (tag == "segments") {
+                double value;
+                while (ss >> value) segments.push_back(value);
+                // Execution first and last, at most MAX_SEGMENTS, nothing negative
+                if (segments.size() % 2 == 0 || segments.size() > (size_t)Task::MAX_SEGMENTS) {
+                    std::cerr << "Warning: " << segments.size() << " segments, need an odd count up to "
+                              << Task::MAX_SEGMENTS << " starting and ending with execution; line skipped: "
+                              << line << std::endl;
+                    return false;
+                }
+                for (size_t k = 0; k < segments.size(); k++) {
+                    if (segments[k] < 0 || (k % 2 == 0 && segments[k] <= 0)) {
+                        std::cerr << "Warning: segment " << k + 1 << " is " << segments[k]
+                                  << (k % 2 == 0 ? ", execution segments must be positive"
+                                                 : ", suspensions must not be negative")
+                                  << "; line skipped: " << line << std::endl;
+                        return false;
+                    }
+                }
+            }
+            ss.clear();
+        }
+        if (j_d < 0) j_d = 0;
+    }
 
-        std::stringstream ss(line);
-        char typeChar;
-        ss >> typeChar;
+    // Default vars
+    double r_d = 0, e_d = 0, p_d = 0, d_d = 0;
 
-        // D is also Periodic, just with explicit deadline
-        TaskType type = TaskType::Periodic;
-        bool hasExplicitDeadline = false;
-        
-        if (typeChar == 'P') {
-            type = TaskType::Periodic;
-            hasExplicitDeadline = false;
+    // --- MAPPING LOGIC ---
+    
+    if (rawNumbers.size() == 2) {
+        // P e p  or  A r e
+        if (type == TaskType::Aperiodic) {
+            // A r e -> Aperiodic: release, exec
+            r_d = rawNumbers[0]; 
+            e_d = rawNumbers[1]; 
+            p_d = 0; 
+            d_d = 0;
+        } else {
+            // P e p -> Periodic: exec, period (r=0, d=p)
+            r_d = 0; 
+            e_d = rawNumbers[0]; 
+            p_d = rawNumbers[1]; 
+            d_d = rawNumbers[1]; // deadline = period
         }
-        else if (typeChar == 'D') {
-            type = TaskType::Periodic;  // D is also periodic!
-            hasExplicitDeadline = true;
+    } 
+    else if (rawNumbers.size() == 3) {
+        if (hasExplicitDeadline) {
+            // D e p d -> Periodic with deadline: exec, period, deadline (r=0)
+            r_d = 0;
+            e_d = rawNumbers[0];
+            p_d = rawNumbers[1];
+            d_d = rawNumbers[2]; // explicit deadline
+        } else {
+            // P r e p -> Periodic: release, exec, period (d=p)
+            r_d = rawNumbers[0];
+            e_d = rawNumbers[1];
+            p_d = rawNumbers[2];
+            d_d = rawNumbers[2]; // deadline = period
         }
-        else if (typeChar == 'A') {
-            type = TaskType::Aperiodic;
+    } 
+    else if (rawNumbers.size() >= 4) {
+        // P r e p d or D r e p d -> release, exec, period, deadline
+        r_d = rawNumbers[0]; 
+        e_d = rawNumbers[1]; 
+        p_d = rawNumbers[2]; 
+        d_d = rawNumbers[3];
+    }
+
+    // SCALE AND CAST TO INT
+    int r = (int)std::round(r_d * SCALE_FACTOR);
+    int e = (int)std::round(e_d * SCALE_FACTOR);
+    int p = (int)std::round(p_d * SCALE_FACTOR);
+    int d = (int)std::round(d_d * SCALE_FACTOR);
+    int j = (int)std::round(j_d * SCALE_FACTOR);
+
+    task = Task(-1, type, r, e, p, d, j); // id is assigned by the caller
+    int executed = 0;
+    for (size_t k = 0; k < segments.size(); k++) {
+        int ticks = (int)std::round(segments[k] * SCALE_FACTOR);
+        task.segments[task.segmentCount++] = ticks;
+        if (k % 2 == 0) executed += ticks;
+    }
+    // The simulator suspends after the declared segments while the analysis
+    // uses e; they must describe the same job
+    if (!segments.empty() && executed != e) {
+        std::cerr << "Warning: execution segments add up to " << (double)executed / SCALE_FACTOR
+                  << ", not the execution time " << e_d << "; line skipped: " << line << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool FileReader::setComputationTime(std::string& line, double units) {
+    Task task;
+    std::string policy;
+    if (!parseLine(line, task, policy) || task.type != TaskType::Periodic) return false;
+
+    std::stringstream ss(line);
+    std::vector<std::string> fields;
+    std::string field;
+    while (ss >> field) fields.push_back(field);
+
+    // Same mapping as parseLine: the exec field is first except in "P r e p"
+    // and the 4-field forms, where the release comes first (trailing tags
+    // such as "jitter J" are not counted)
+    auto isNumber = [](const std::string& text) {
+        char* end = nullptr;
+        std::strtod(text.c_str(), &end);
+        return end != text.c_str() && *end == '\0';
+    };
+    size_t numbers = 0;
+    while (numbers + 1 < fields.size() && isNumber(fields[numbers + 1])) numbers++;
+    size_t index = (numbers >= 4 || (numbers == 3 && fields[0][0] == 'P')) ? 2 : 1;
+    if (numbers < 2 || index >= fields.size()) return false;
+
+    // Execution segments are rescaled to the new execution time (whole
+    // ticks, the last one takes the rounding); suspensions stay as written
+    int e = (int)std::round(units * SCALE_FACTOR);
+    if (task.segmentCount > 0) {
+        size_t first = 0;
+        while (first < fields.size() && fields[first] != "segments") first++;
+        if (first + task.segmentCount >= fields.size() || task.computationTime <= 0) return false;
+
+        int assigned = 0;
+        for (int k = 0; k + 1 < task.segmentCount; k += 2) {
+            int scaled = std::max(1, (int)std::round((double)task.segments[k] * e / task.computationTime));
+            task.segments[k] = scaled;
+            assigned += scaled;
         }
-        else continue;
+        task.segments[task.segmentCount - 1] = e - assigned;
+        if (task.segments[task.segmentCount - 1] <= 0) return false; // Too short to keep every segment
 
-        std::vector<double> rawNumbers;
-        double num;
-        while (ss >> num) rawNumbers.push_back(num);
-        
-        // Check Policy Tags for Aperiodic tasks
-        if (type == TaskType::Aperiodic) {
-            ss.clear();
-            std::string remaining;
-            std::getline(ss, remaining);
-            if (remaining.find("Poller") != std::string::npos) result.serverPolicy = "Poller";
-            else if (remaining.find("Deferrable") != std::string::npos) result.serverPolicy = "Deferrable";
+        for (int k = 0; k < task.segmentCount; k += 2) {
+            std::ostringstream segment;
+            segment << (double)task.segments[k] / SCALE_FACTOR;
+            fields[first + 1 + k] = segment.str();
         }
+    }
 
-        // Default vars
-        double r_d = 0, e_d = 0, p_d = 0, d_d = 0;
+    std::ostringstream value;
+    value << units;
+    fields[index] = value.str();
 
-        // --- MAPPING LOGIC ---
-        
-        if (rawNumbers.size() == 2) {
-            // P e p  or  A r e
-            if (type == TaskType::Aperiodic) {
-                // A r e -> Aperiodic: release, exec
-                r_d = rawNumbers[0]; 
-                e_d = rawNumbers[1]; 
-                p_d = 0; 
-                d_d = 0;
-            } else {
-                // P e p -> Periodic: exec, period (r=0, d=p)
-                r_d = 0; 
-                e_d = rawNumbers[0]; 
-                p_d = rawNumbers[1]; 
-                d_d = rawNumbers[1]; // deadline = period
-            }
-        } 
-        else if (rawNumbers.size() == 3) {
-            if (hasExplicitDeadline) {
-                // D e p d -> Periodic with deadline: exec, period, deadline (r=0)
-                r_d = 0;
-                e_d = rawNumbers[0];
-                p_d = rawNumbers[1];
-                d_d = rawNumbers[2]; // explicit deadline
-            } else {
-                // P r e p -> Periodic: release, exec, period (d=p)
-                r_d = rawNumbers[0];
-                e_d = rawNumbers[1];
-                p_d = rawNumbers[2];
-                d_d = rawNumbers[2]; // deadline = period
-            }
-        } 
-        else if (rawNumbers.size() >= 4) {
-            // P r e p d or D r e p d -> release, exec, period, deadline
-            r_d = rawNumbers[0]; 
-            e_d = rawNumbers[1]; 
-            p_d = rawNumbers[2]; 
-            d_d = rawNumbers[3];
-        }
+    line = fields[0];
+    for (size_t k = 1; k < fields.size(); k++) line += " " + fields[k];
+    return true;
+}
 
-        // SCALE AND CAST TO INT
-        int r = (int)std::round(r_d * SCALE_FACTOR);
-        int e = (int)std::round(e_d * SCALE_FACTOR);
-        int p = (int)std::round(p_d * SCALE_FACTOR);
-        int d = (int)std::round(d_d * SCALE_FACTOR);
+FileReader::ParseResult FileReader::readInputFile(const std::string& filename) {
+    ParseResult result;
+    result.serverPolicy = "Background"; 
+    
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        std::cerr << "Error: Could not open file " << filename << std::endl;
+        return result;
+    }
+
+    std::string line;
+    int taskIdCounter = 1;
+
+    while (std::getline(file, line)) {
+        Task newTask;
+        std::string policy;
+        if (!parseLine(line, newTask, policy)) continue;
+        if (!policy.empty()) result.serverPolicy = policy;
 
-        Task newTask(taskIdCounter++, type, r, e, p, d);
+        newTask.id = taskIdCounter++;
         
-        if (type == TaskType::Aperiodic) result.aperiodicTasks.push_back(newTask);
+        if (newTask.type == TaskType::Aperiodic) result.aperiodicTasks.push_back(newTask);
         else result.periodicTasks.push_back(newTask);
     }
     file.close();
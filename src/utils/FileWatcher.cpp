@@ -0,0 +1,101 @@
+#include "../../include/utils/FileWatcher.h"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <thread>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+const int POLL_INTERVAL_MS = 200;
+const int SETTLE_MS = 50; // Quiet time that ends a burst of writes
+
+} // namespace
+
+FileWatcher::FileWatcher(const std::string& path) : fd(-1), wd(-1) {
+    std::filesystem::path p(path);
+    directory = p.has_parent_path() ? p.parent_path().string() : ".";
+    name = p.filename().string();
+    lastStamp = stamp();
+
+#ifdef __linux__
+    fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fd >= 0) {
+        wd = inotify_add_watch(fd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+        if (wd < 0) {
+            close(fd);
+            fd = -1;
+        }
+    }
+#endif
+}
+
+FileWatcher::~FileWatcher() {
+#ifdef __linux__
+    if (fd >= 0) close(fd);
+#endif
+}
+
+int64_t FileWatcher::stamp() const {
+    std::error_code ec;
+    std::filesystem::path p = std::filesystem::path(directory) / name;
+    auto time = std::filesystem::last_write_time(p, ec);
+    if (ec) return -1;
+    auto size = std::filesystem::file_size(p, ec);
+    return (int64_t)time.time_since_epoch().count() ^ ((int64_t)size << 48);
+}
+
+bool FileWatcher::readEvents(int timeoutMs) {
+#ifdef __linux__
+    pollfd pfd{fd, POLLIN, 0};
+    if (poll(&pfd, 1, timeoutMs) <= 0) return false;
+
+    alignas(inotify_event) char buffer[4096];
+    bool hit = false;
+    ssize_t len;
+    while ((len = read(fd, buffer, sizeof(buffer))) > 0) {
+        for (char* p = buffer; p < buffer + len;) {
+            const inotify_event* event = reinterpret_cast<const inotify_event*>(p);
+            if (event->len > 0 && name == event->name) hit = true;
+            p += sizeof(inotify_event) + event->len;
+        }
+    }
+    return hit;
+#else
+    (void)timeoutMs;
+    return false;
+#endif
+}
+
+bool FileWatcher::waitForChange(int timeoutMs) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+
+    while (true) {
+        int left = (int)std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now()).count();
+        if (left <= 0) return false;
+
+        bool changed;
+        if (fd >= 0) {
+            changed = readEvents(left);
+        } else {
+            std::this_thread::sleep_for(std::chrono::milliseconds(std::min(left, POLL_INTERVAL_MS)));
+            changed = stamp() != lastStamp;
+        }
+        if (!changed) continue;
+
+        // Let the burst settle, then report once
+        if (fd >= 0) {
+            while (readEvents(SETTLE_MS)) {}
+        } else {
+            std::this_thread::sleep_for(std::chrono::milliseconds(SETTLE_MS));
+        }
+        lastStamp = stamp();
+        return true;
+    }
+}
@@ -0,0 +1,374 @@
+#include "../../include/utils/GanttRenderer.h"
+#include "../../include/utils/PngWriter.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+
+namespace {
+
+const int MARGIN_LEFT = 170;
+const int MARGIN_RIGHT = 20;
+const int MARGIN_TOP = 48;
+const int AXIS_HEIGHT = 40;
+const int PANEL_GAP = 16;
+
+const uint32_t BACKGROUND = 0xFFFFFF;
+const uint32_t INK = 0x222222;
+const uint32_t GRID = 0xDDDDDD;
+const uint32_t RED = 0xD62728;
+const uint32_t ORANGE = 0xFF7F0E;
+
+// Same label the scheduler writes for deadline misses in output.txt; also
+// used for lanes that only ever show arrivals, deadlines or misses
+const char* const FAILURE_LABEL = "FAILURE";
+
+std::string hex(uint32_t color) {
+    char buf[8];
+    std::snprintf(buf, sizeof(buf), "#%06X", color & 0xFFFFFF);
+    return buf;
+}
+
+std::string escapeXml(const std::string& s) {
+    std::string out;
+    for (char c : s) {
+        if (c == '<') out += "&lt;";
+        else if (c == '>') out += "&gt;";
+        else if (c == '&') out += "&amp;";
+        else out += c;
+    }
+    return out;
+}
+
+std::string formatUnits(double value) {
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%g", value);
+    return buf;
+}
+
+} // namespace
+
+GanttRenderer::GanttRenderer(const Options& options)
+    : options(options), scale(1), end(0), budgetCapacity(0) {
+    columns = std::max(16, options.width - MARGIN_LEFT - MARGIN_RIGHT);
+    budgetMin.assign(columns, -1);
+    budgetMax.assign(columns, -1);
+}
+
+uint32_t GanttRenderer::colorOf(const std::string& description) {
+    // Same palette as visualizer.py
+    if (description.find("Server") != std::string::npos) return ORANGE;
+    if (description == "Periodic") return 0x1F77B4;
+    if (description == "Aperiodic") return 0x2CA02C;
+    if (description == "Background") return 0x9467BD;
+    if (description == FAILURE_LABEL) return RED;
+    return 0x7F7F7F;
+}
+
+GanttRenderer::Lane& GanttRenderer::lane(int taskId, const std::string& description) {
+    auto it = laneOf.find(taskId);
+    if (it != laneOf.end()) {
+        Lane& existing = lanes[it->second];
+        bool upgrade = description.find("Server") != std::string::npos ||
+                       (existing.description == FAILURE_LABEL && !description.empty());
+        if (upgrade) existing.description = description;
+        return existing;
+    }
+
+    laneOf[taskId] = lanes.size();
+    lanes.push_back({taskId, description.empty() ? FAILURE_LABEL : description,
+                     std::vector<uint32_t>(columns, 0), std::vector<uint8_t>(columns, 0),
+                     std::vector<uint8_t>(columns, 0), std::vector<uint8_t>(columns, 0)});
+    return lanes.back();
+}
+
+void GanttRenderer::fold() {
+    // Column c of the new scale covers old columns 2c and 2c+1
+    for (auto& l : lanes) {
+        for (int c = 0; c < columns; c++) {
+            uint32_t busy = l.busy[c];
+            uint8_t a = l.arrivals[c], d = l.deadlines[c], m = l.misses[c];
+            l.busy[c] = 0;
+            l.arrivals[c] = l.deadlines[c] = l.misses[c] = 0;
+            int to = c / 2;
+            l.busy[to] += busy;
+            l.arrivals[to] |= a;
+            l.deadlines[to] |= d;
+            l.misses[to] |= m;
+        }
+    }
+    for (int c = 0; c < columns; c++) {
+        int to = c / 2;
+        int32_t lo = budgetMin[c], hi = budgetMax[c];
+        budgetMin[c] = budgetMax[c] = -1;
+        if (lo < 0) continue;
+        budgetMin[to] = budgetMin[to] < 0 ? lo : std::min(budgetMin[to], lo);
+        budgetMax[to] = std::max(budgetMax[to], hi);
+    }
+    scale *= 2;
+}
+
+void GanttRenderer::reserve(int tick) {
+    while (tick >= (long long)columns * scale) fold();
+    end = std::max(end, tick + 1);
+}
+
+void GanttRenderer::extendTo(int tick) {
+    if (tick > 0) reserve(tick - 1);
+}
+
+void GanttRenderer::addSlice(int taskId, const std::string& description, int start, int stop) {
+    if (stop <= start || start < 0) return;
+    reserve(stop - 1);
+    Lane& l = lane(taskId, description);
+
+    // Split over the columns the slice touches, so cost is bounded by width
+    for (int c = start / scale; c <= (stop - 1) / scale; c++) {
+        int from = std::max(start, c * scale);
+        int to = std::min(stop, (c + 1) * scale);
+        l.busy[c] += (uint32_t)(to - from);
+    }
+}
+
+void GanttRenderer::addArrival(int taskId, int tick) {
+    if (tick < 0) return;
+    reserve(tick);
+    lane(taskId, "").arrivals[tick / scale] = 1;
+}
+
+void GanttRenderer::addDeadline(int taskId, int tick) {
+    if (tick < 0) return;
+    reserve(tick);
+    lane(taskId, "").deadlines[tick / scale] = 1;
+}
+
+void GanttRenderer::addMiss(int taskId, int tick) {
+    if (tick < 0) return;
+    reserve(tick);
+    lane(taskId, "").misses[tick / scale] = 1;
+}
+
+void GanttRenderer::addBudget(int tick, int budget, int capacity) {
+    if (tick < 0 || budget < 0) return;
+    reserve(tick);
+    budgetCapacity = std::max({budgetCapacity, capacity, budget});
+    int c = tick / scale;
+    budgetMin[c] = budgetMin[c] < 0 ? budget : std::min(budgetMin[c], budget);
+    budgetMax[c] = std::max(budgetMax[c], budget);
+}
+
+std::vector<GanttRenderer::Shape> GanttRenderer::layout(int& height) const {
+    std::vector<Shape> shapes;
+    auto rect = [&](int x, int y, int w, int h, uint32_t color, float alpha) {
+        shapes.push_back({Shape::Rect, x, y, std::max(1, w), h, color, alpha, ""});
+    };
+    auto line = [&](int x0, int y0, int x1, int y1, uint32_t color, bool dashed) {
+        shapes.push_back({dashed ? Shape::DashedLine : Shape::Line, x0, y0, x1, y1, color, 1.0f, ""});
+    };
+    auto text = [&](Shape::Kind kind, int x, int y, const std::string& s, uint32_t color) {
+        shapes.push_back({kind, x, y, x, y, color, 1.0f, s});
+    };
+
+    // Lanes top to bottom by task id, the server (largest id) last
+    std::vector<const Lane*> order;
+    for (const auto& l : lanes) order.push_back(&l);
+    std::sort(order.begin(), order.end(), [](const Lane* a, const Lane* b) { return a->taskId < b->taskId; });
+
+    bool hasBudget = budgetCapacity > 0;
+    int plotWidth = columns;
+    int lanesTop = MARGIN_TOP;
+    int lanesBottom = lanesTop + (int)order.size() * options.laneHeight;
+    int budgetTop = lanesBottom + PANEL_GAP;
+    int plotBottom = hasBudget ? budgetTop + options.budgetHeight : lanesBottom;
+    height = plotBottom + AXIS_HEIGHT;
+
+    int horizonTicks = std::max(1, end);
+    int used = std::max(1, (horizonTicks + scale - 1) / scale);
+    auto xOf = [&](long long tick) {
+        return MARGIN_LEFT + (int)std::min<long long>(plotWidth, tick * plotWidth / horizonTicks);
+    };
+    auto columnSpan = [&](int from, int to, int& x, int& w) {
+        x = xOf((long long)from * scale);
+        w = xOf(std::min<long long>((long long)to * scale, horizonTicks)) - x;
+    };
+
+    // --- GRID AND AXIS ---
+    double units = (double)horizonTicks / options.ticksPerUnit;
+    double raw = units / 10.0;
+    double magnitude = std::pow(10.0, std::floor(std::log10(std::max(raw, 1e-9))));
+    double step = magnitude;
+    for (double m : {1.0, 2.0, 5.0, 10.0}) {
+        if (magnitude * m >= raw) { step = magnitude * m; break; }
+    }
+    for (int i = 0;; i++) {
+        double value = i * step;
+        long long tick = std::llround(value * options.ticksPerUnit);
+        if (tick > horizonTicks) break;
+        int x = xOf(tick);
+        line(x, lanesTop, x, plotBottom, GRID, false);
+        line(x, plotBottom, x, plotBottom + 5, INK, false);
+        text(Shape::TextCenter, x, plotBottom + 16, formatUnits(value), INK);
+    }
+    line(MARGIN_LEFT, plotBottom, MARGIN_LEFT + plotWidth, plotBottom, INK, false);
+    text(Shape::TextCenter, MARGIN_LEFT + plotWidth / 2, plotBottom + 32, "Time", INK);
+    text(Shape::TextCenter, MARGIN_LEFT + plotWidth / 2, MARGIN_TOP / 3, options.title, INK);
+
+    // --- TASK LANES ---
+    std::vector<uint8_t> missColumn(used, 0);
+    std::vector<std::string> legend;
+    for (size_t i = 0; i < order.size(); i++) {
+        const Lane& l = *order[i];
+        int top = lanesTop + (int)i * options.laneHeight;
+        int barTop = top + 4, barHeight = options.laneHeight - 8;
+        uint32_t color = colorOf(l.description);
+        if (std::find(legend.begin(), legend.end(), l.description) == legend.end()) legend.push_back(l.description);
+
+        text(Shape::TextRight, MARGIN_LEFT - 8, top + options.laneHeight / 2,
+             l.description + " (T" + std::to_string(l.taskId) + ")", INK);
+
+        // Coverage quantized to 4 shades, equal neighbours merged into one rect
+        auto levelOf = [&](int c) {
+            if (l.busy[c] == 0) return 0;
+            int span = std::min(scale, horizonTicks - c * scale);
+            if ((int)l.busy[c] >= span) return 4;
+            return 1 + std::min(2, (int)(3 * l.busy[c] / std::max(1, span)));
+        };
+        for (int c = 0; c < used;) {
+            int level = levelOf(c);
+            int runEnd = c + 1;
+            while (runEnd < used && levelOf(runEnd) == level) runEnd++;
+            if (level > 0) {
+                int x, w;
+                columnSpan(c, runEnd, x, w);
+                rect(x, barTop, w, barHeight, color, 0.25f + 0.1875f * level);
+            }
+            c = runEnd;
+        }
+
+        // Markers closer than ~3 pixels apart would only draw a solid band
+        int arrivalCount = (int)std::count(l.arrivals.begin(), l.arrivals.begin() + used, 1);
+        int deadlineCount = (int)std::count(l.deadlines.begin(), l.deadlines.begin() + used, 1);
+        bool showArrivals = arrivalCount * 3 <= plotWidth;
+        bool showDeadlines = deadlineCount * 3 <= plotWidth;
+
+        for (int c = 0; c < used; c++) {
+            int x = xOf((long long)c * scale);
+            if (showArrivals && l.arrivals[c]) line(x, top + options.laneHeight - 2, x, top + options.laneHeight - 9, INK, false);
+            if (showDeadlines && l.deadlines[c]) line(x, top + 2, x, top + 9, 0x888888, false);
+            if (l.misses[c]) {
+                int cy = top + options.laneHeight / 2;
+                line(x - 5, cy - 5, x + 5, cy + 5, RED, false);
+                line(x - 5, cy + 5, x + 5, cy - 5, RED, false);
+                missColumn[c] = 1;
+            }
+        }
+    }
+    for (int c = 0; c < used; c++) {
+        if (missColumn[c]) {
+            int x = xOf((long long)c * scale);
+            line(x, lanesTop, x, lanesBottom, RED, true);
+        }
+    }
+
+    // --- SERVER BUDGET ---
+    if (hasBudget) {
+        int base = budgetTop + options.budgetHeight;
+        auto yOf = [&](int budget) { return base - budget * options.budgetHeight / budgetCapacity; };
+        text(Shape::TextRight, MARGIN_LEFT - 8, budgetTop + options.budgetHeight / 2, "Server budget", INK);
+        text(Shape::TextRight, MARGIN_LEFT - 8, budgetTop + 6,
+             formatUnits((double)budgetCapacity / options.ticksPerUnit), INK);
+        line(MARGIN_LEFT, budgetTop, MARGIN_LEFT + plotWidth, budgetTop, GRID, true);
+
+        for (int c = 0; c < used;) {
+            int runEnd = c + 1;
+            while (runEnd < used && budgetMin[runEnd] == budgetMin[c] && budgetMax[runEnd] == budgetMax[c]) runEnd++;
+            if (budgetMin[c] >= 0) {
+                int x, w;
+                columnSpan(c, runEnd, x, w);
+                rect(x, yOf(budgetMin[c]), w, base - yOf(budgetMin[c]), ORANGE, 0.7f);
+                if (budgetMax[c] > budgetMin[c]) {
+                    rect(x, yOf(budgetMax[c]), w, yOf(budgetMin[c]) - yOf(budgetMax[c]), ORANGE, 0.3f);
+                }
+            }
+            c = runEnd;
+        }
+    }
+
+    // --- LEGEND (top right) ---
+    bool anyMiss = std::find(missColumn.begin(), missColumn.end(), 1) != missColumn.end();
+    if (anyMiss) legend.push_back("DEADLINE MISS");
+    int x = MARGIN_LEFT + plotWidth;
+    for (auto it = legend.rbegin(); it != legend.rend(); ++it) {
+        x -= PngWriter::textWidth(*it) + 8;
+        text(Shape::Text, x, MARGIN_TOP / 2 + 12, *it, INK);
+        x -= 14;
+        rect(x, MARGIN_TOP / 2 + 7, 10, 10, *it == "DEADLINE MISS" ? RED : colorOf(*it), 1.0f);
+        x -= 12;
+    }
+
+    return shapes;
+}
+
+bool GanttRenderer::writeSvg(const std::string& path) const {
+    std::ofstream out(path, std::ios::trunc);
+    if (!out.is_open()) return false;
+
+    int height = 0;
+    std::vector<Shape> shapes = layout(height);
+
+    out << "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"" << options.width << "\" height=\"" << height
+        << "\" font-family=\"sans-serif\" font-size=\"12\">\n";
+    out << "<rect width=\"100%\" height=\"100%\" fill=\"" << hex(BACKGROUND) << "\"/>\n";
+
+    for (const auto& s : shapes) {
+        switch (s.kind) {
+            case Shape::Rect:
+                out << "<rect x=\"" << s.x0 << "\" y=\"" << s.y0 << "\" width=\"" << s.x1 << "\" height=\"" << s.y1
+                    << "\" fill=\"" << hex(s.color) << "\"";
+                if (s.alpha < 1.0f) out << " fill-opacity=\"" << s.alpha << "\"";
+                out << "/>\n";
+                break;
+            case Shape::Line:
+            case Shape::DashedLine:
+                out << "<line x1=\"" << s.x0 << "\" y1=\"" << s.y0 << "\" x2=\"" << s.x1 << "\" y2=\"" << s.y1
+                    << "\" stroke=\"" << hex(s.color) << "\"";
+                if (s.kind == Shape::DashedLine) out << " stroke-dasharray=\"4 3\"";
+                out << "/>\n";
+                break;
+            default: {
+                const char* anchor = s.kind == Shape::TextRight ? "end" : s.kind == Shape::TextCenter ? "middle" : "start";
+                out << "<text x=\"" << s.x0 << "\" y=\"" << s.y0 << "\" text-anchor=\"" << anchor
+                    << "\" dominant-baseline=\"middle\" fill=\"" << hex(s.color) << "\">" << escapeXml(s.text) << "</text>\n";
+                break;
+            }
+        }
+    }
+    out << "</svg>\n";
+    return (bool)out;
+}
+
+bool GanttRenderer::writePng(const std::string& path) const {
+    int height = 0;
+    std::vector<Shape> shapes = layout(height);
+
+    PngWriter png(options.width, height, BACKGROUND);
+    for (const auto& s : shapes) {
+        switch (s.kind) {
+            case Shape::Rect:
+                png.fillRect(s.x0, s.y0, s.x1, s.y1, s.color, s.alpha);
+                break;
+            case Shape::Line:
+            case Shape::DashedLine:
+                png.line(s.x0, s.y0, s.x1, s.y1, s.color, s.kind == Shape::DashedLine);
+                break;
+            default: {
+                // Font is 5 rows of 2 pixels, centered on y like the SVG text
+                int w = PngWriter::textWidth(s.text);
+                int x = s.kind == Shape::TextRight ? s.x0 - w : s.kind == Shape::TextCenter ? s.x0 - w / 2 : s.x0;
+                png.text(x, s.y0 - 5, s.text, s.color);
+                break;
+            }
+        }
+    }
+    return png.write(path);
+}
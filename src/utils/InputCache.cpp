@@ -0,0 +1,45 @@
+#include "../../include/utils/InputCache.h"
+#include <fstream>
+#include <iostream>
+
+FileReader::ParseResult InputCache::load(const std::string& filename) {
+    FileReader::ParseResult result;
+    result.serverPolicy = "Background";
+    lines = 0;
+    reparsed = 0;
+
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        std::cerr << "Error: Could not open file " << filename << std::endl;
+        return result;
+    }
+
+    std::unordered_map<std::string, Entry> current;
+    std::string line;
+    int taskIdCounter = 1;
+
+    while (std::getline(file, line)) {
+        lines++;
+
+        auto it = parsed.find(line);
+        if (it == parsed.end()) {
+            Entry entry;
+            entry.valid = FileReader::parseLine(line, entry.task, entry.policy);
+            it = parsed.emplace(line, entry).first;
+            reparsed++;
+        }
+        const Entry& entry = it->second;
+        current.emplace(line, entry);
+        if (!entry.valid) continue;
+        if (!entry.policy.empty()) result.serverPolicy = entry.policy;
+
+        Task task = entry.task;
+        task.id = taskIdCounter++;
+        if (task.type == TaskType::Aperiodic) result.aperiodicTasks.push_back(task);
+        else result.periodicTasks.push_back(task);
+    }
+
+    // Drop lines that are gone so the cache doesn't grow across edits
+    parsed.swap(current);
+    return result;
+}
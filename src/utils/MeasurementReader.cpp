@@ -0,0 +1,38 @@
+#include "../../include/utils/MeasurementReader.h"
+#include <fstream>
+#include <cstdlib>
+
+MeasurementReader::Counts MeasurementReader::read(const std::string& path, int defaultId,
+                                                  const std::function<void(int, double)>& sink) {
+    Counts counts;
+    std::ifstream file(path);
+    if (!file.is_open()) return counts;
+    counts.opened = true;
+
+    std::string line;
+    while (std::getline(file, line)) {
+        const char* p = line.c_str();
+        double values[2] = {0, 0};
+        int found = 0;
+        bool bad = false;
+        while (found < 2) {
+            while (*p == ' ' || *p == '\t' || *p == ',') p++;
+            if (*p == '\0' || *p == '#' || *p == '\r') break;
+            char* end = nullptr;
+            double v = std::strtod(p, &end);
+            if (end == p) { bad = true; break; }
+            values[found++] = v;
+            p = end;
+        }
+        if (found == 0 && !bad) continue; // Blank or comment
+
+        if (bad || (found == 1 && defaultId < 0)) { counts.skippedLines++; continue; }
+        int id = found == 2 ? (int)values[0] : defaultId;
+        double time = found == 2 ? values[1] : values[0];
+        if (time < 0) { counts.skippedLines++; continue; }
+
+        sink(id, time);
+        counts.samples++;
+    }
+    return counts;
+}
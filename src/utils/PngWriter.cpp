@@ -0,0 +1,175 @@
+#include "../../include/utils/PngWriter.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+
+namespace {
+
+// 3x5 glyphs, rows top to bottom, '1' = pixel set
+struct Glyph {
+    char c;
+    const char* rows;
+};
+
+const Glyph FONT[] = {
+    {'0', "111101101101111"}, {'1', "010110010010111"}, {'2', "111001111100111"},
+    {'3', "111001111001111"}, {'4', "101101111001001"}, {'5', "111100111001111"},
+    {'6', "111100111101111"}, {'7', "111001001010010"}, {'8', "111101111101111"},
+    {'9', "111101111001111"}, {'A', "010101111101101"}, {'B', "110101110101110"},
+    {'C', "011100100100011"}, {'D', "110101101101110"}, {'E', "111100110100111"},
+    {'F', "111100110100100"}, {'G', "011100101101011"}, {'H', "101101111101101"},
+    {'I', "111010010010111"}, {'J', "001001001101010"}, {'K', "101101110101101"},
+    {'L', "100100100100111"}, {'M', "101111111101101"}, {'N', "110101101101101"},
+    {'O', "010101101101010"}, {'P', "110101110100100"}, {'Q', "010101101110011"},
+    {'R', "110101110101101"}, {'S', "011100010001110"}, {'T', "111010010010010"},
+    {'U', "101101101101111"}, {'V', "101101101101010"}, {'W', "101101111111101"},
+    {'X', "101101010101101"}, {'Y', "101101010010010"}, {'Z', "111001010100111"},
+    {'(', "010100100100010"}, {')', "010001001001010"}, {':', "000010000010000"},
+    {'.', "000000000000010"}, {'-', "000000111000000"}, {'/', "001001010100100"},
+    {'%', "101001010100101"}, {'_', "000000000000111"}, {'=', "000111000111000"},
+    {',', "000000000010100"},
+};
+
+const char* glyphFor(char c) {
+    c = (char)std::toupper((unsigned char)c);
+    for (const auto& g : FONT) {
+        if (g.c == c) return g.rows;
+    }
+    return nullptr;
+}
+
+uint32_t crc32(const uint8_t* data, size_t len, uint32_t crc = 0) {
+    static uint32_t table[256];
+    static bool ready = false;
+    if (!ready) {
+        for (uint32_t n = 0; n < 256; n++) {
+            uint32_t c = n;
+            for (int k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            table[n] = c;
+        }
+        ready = true;
+    }
+    crc = ~crc;
+    for (size_t i = 0; i < len; i++) crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+void putBE32(std::vector<uint8_t>& out, uint32_t v) {
+    out.push_back((uint8_t)(v >> 24));
+    out.push_back((uint8_t)(v >> 16));
+    out.push_back((uint8_t)(v >> 8));
+    out.push_back((uint8_t)v);
+}
+
+void writeChunk(std::ofstream& out, const char* type, const std::vector<uint8_t>& data) {
+    std::vector<uint8_t> buf;
+    putBE32(buf, (uint32_t)data.size());
+    buf.insert(buf.end(), type, type + 4);
+    buf.insert(buf.end(), data.begin(), data.end());
+    uint32_t crc = crc32(buf.data() + 4, buf.size() - 4);
+    putBE32(buf, crc);
+    out.write(reinterpret_cast<const char*>(buf.data()), buf.size());
+}
+
+} // namespace
+
+PngWriter::PngWriter(int width, int height, uint32_t background)
+    : w(std::max(1, width)), h(std::max(1, height)), pixels((size_t)w * h * 3) {
+    fillRect(0, 0, w, h, background);
+}
+
+void PngWriter::blend(int x, int y, uint32_t color, float alpha) {
+    if (x < 0 || y < 0 || x >= w || y >= h) return;
+    uint8_t* p = &pixels[((size_t)y * w + x) * 3];
+    uint8_t rgb[3] = {(uint8_t)(color >> 16), (uint8_t)(color >> 8), (uint8_t)color};
+    for (int i = 0; i < 3; i++) p[i] = (uint8_t)(p[i] + (rgb[i] - p[i]) * alpha + 0.5f);
+}
+
+void PngWriter::fillRect(int x, int y, int width, int height, uint32_t color, float alpha) {
+    int x0 = std::max(0, x), y0 = std::max(0, y);
+    int x1 = std::min(w, x + width), y1 = std::min(h, y + height);
+    for (int yy = y0; yy < y1; yy++) {
+        for (int xx = x0; xx < x1; xx++) blend(xx, yy, color, alpha);
+    }
+}
+
+void PngWriter::line(int x0, int y0, int x1, int y1, uint32_t color, bool dashed) {
+    // Bresenham; dashes are 4 pixels on, 3 off
+    int dx = std::abs(x1 - x0), dy = -std::abs(y1 - y0);
+    int sx = x0 < x1 ? 1 : -1, sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy;
+    for (int step = 0;; step++) {
+        if (!dashed || step % 7 < 4) blend(x0, y0, color, 1.0f);
+        if (x0 == x1 && y0 == y1) break;
+        int e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x0 += sx; }
+        if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+}
+
+void PngWriter::text(int x, int y, const std::string& s, uint32_t color, int scale) {
+    for (char c : s) {
+        const char* rows = glyphFor(c);
+        if (rows) {
+            for (int r = 0; r < 5; r++) {
+                for (int col = 0; col < 3; col++) {
+                    if (rows[r * 3 + col] == '1') fillRect(x + col * scale, y + r * scale, scale, scale, color);
+                }
+            }
+        }
+        x += 4 * scale;
+    }
+}
+
+bool PngWriter::write(const std::string& path) const {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) return false;
+
+    out.write("\x89PNG\r\n\x1a\n", 8);
+
+    std::vector<uint8_t> header;
+    putBE32(header, (uint32_t)w);
+    putBE32(header, (uint32_t)h);
+    header.push_back(8); // bit depth
+    header.push_back(2); // truecolor RGB
+    header.push_back(0); // deflate
+    header.push_back(0); // adaptive filtering
+    header.push_back(0); // no interlace
+    writeChunk(out, "IHDR", header);
+
+    // Scanlines with filter type 0, wrapped in stored deflate blocks
+    std::vector<uint8_t> raw;
+    raw.reserve((size_t)h * (w * 3 + 1));
+    for (int y = 0; y < h; y++) {
+        raw.push_back(0);
+        raw.insert(raw.end(), pixels.begin() + (size_t)y * w * 3, pixels.begin() + (size_t)(y + 1) * w * 3);
+    }
+
+    std::vector<uint8_t> z;
+    z.reserve(raw.size() + raw.size() / 65535 * 5 + 16);
+    z.push_back(0x78);
+    z.push_back(0x01);
+    size_t pos = 0;
+    do {
+        size_t len = std::min<size_t>(65535, raw.size() - pos);
+        bool last = pos + len == raw.size();
+        z.push_back(last ? 1 : 0);
+        z.push_back((uint8_t)len);
+        z.push_back((uint8_t)(len >> 8));
+        z.push_back((uint8_t)~len);
+        z.push_back((uint8_t)(~len >> 8));
+        z.insert(z.end(), raw.begin() + pos, raw.begin() + pos + len);
+        pos += len;
+    } while (pos < raw.size());
+
+    uint32_t a = 1, b = 0;
+    for (uint8_t v : raw) {
+        a = (a + v) % 65521;
+        b = (b + a) % 65521;
+    }
+    putBE32(z, (b << 16) | a);
+    writeChunk(out, "IDAT", z);
+    writeChunk(out, "IEND", {});
+    return (bool)out;
+}
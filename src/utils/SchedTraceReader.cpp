@@ -0,0 +1,166 @@
+#include "../../include/utils/SchedTraceReader.h"
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+const size_t BLOCK_SIZE = 4 << 20;
+
+bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+// Digits at the start of `text`; false if there are none
+bool leadingInt(std::string_view text, int& value) {
+    size_t k = 0;
+    long long v = 0;
+    while (k < text.size() && isDigit(text[k])) v = v * 10 + (text[k++] - '0');
+    value = (int)v;
+    return k > 0;
+}
+
+// Value after `key` (e.g. "pid=") up to the next space
+bool field(std::string_view payload, std::string_view key, std::string_view& value) {
+    size_t at = payload.find(key);
+    if (at == std::string_view::npos) return false;
+    value = payload.substr(at + key.size());
+    value = value.substr(0, value.find(' '));
+    return true;
+}
+
+// "comm:pid [prio]..." -> comm, pid (the comm may itself contain ':' or spaces)
+bool commPid(std::string_view text, std::string_view& comm, int& pid) {
+    size_t bracket = text.find(" [");
+    if (bracket == std::string_view::npos) return false;
+    std::string_view id = text.substr(0, bracket);
+    size_t colon = id.rfind(':');
+    if (colon == std::string_view::npos) return false;
+    comm = id.substr(0, colon);
+    while (!comm.empty() && comm.front() == ' ') comm.remove_prefix(1);
+    return leadingInt(id.substr(colon + 1), pid);
+}
+
+} // namespace
+
+bool SchedTraceReader::parseLine(std::string_view line, Event& event, bool& relevant) {
+    relevant = false;
+    size_t at = line.find(": sched_");
+    if (at == std::string_view::npos) return false;
+
+    std::string_view rest = line.substr(at + 2);
+    size_t nameLength;
+    if (rest.compare(0, 13, "sched_switch:") == 0) {
+        event.kind = Event::Kind::Switch;
+        nameLength = 13;
+    } else if (rest.compare(0, 13, "sched_wakeup:") == 0) {
+        event.kind = Event::Kind::Wakeup;
+        nameLength = 13;
+    } else if (rest.compare(0, 17, "sched_wakeup_new:") == 0) {
+        event.kind = Event::Kind::Wakeup;
+        nameLength = 17;
+    } else {
+        return false;
+    }
+    relevant = true;
+
+    // Timestamp "secs.fraction" right before the ": sched_"
+    size_t begin = at;
+    while (begin > 0 && (isDigit(line[begin - 1]) || line[begin - 1] == '.')) begin--;
+    std::string_view stamp = line.substr(begin, at - begin);
+    size_t dot = stamp.find('.');
+    if (stamp.empty() || dot == std::string_view::npos) return false;
+    uint64_t seconds = 0, fraction = 0;
+    for (size_t k = 0; k < dot; k++) seconds = seconds * 10 + (stamp[k] - '0');
+    size_t digits = 0;
+    for (size_t k = dot + 1; k < stamp.size() && digits < 9; k++, digits++) fraction = fraction * 10 + (stamp[k] - '0');
+    for (; digits < 9; digits++) fraction *= 10;
+    event.timestamp = seconds * 1000000000ull + fraction;
+
+    // CPU: the last "[NNN]" before the timestamp
+    size_t open = line.rfind('[', begin);
+    event.cpu = -1;
+    if (open != std::string_view::npos) leadingInt(line.substr(open + 1), event.cpu);
+
+    std::string_view payload = rest.substr(nameLength);
+    while (!payload.empty() && payload.front() == ' ') payload.remove_prefix(1);
+
+    std::string_view value;
+    if (event.kind == Event::Kind::Wakeup) {
+        if (payload.compare(0, 5, "comm=") == 0) {
+            size_t pidAt = payload.find(" pid=");
+            if (pidAt == std::string_view::npos) return false;
+            event.comm = payload.substr(5, pidAt - 5);
+            return leadingInt(payload.substr(pidAt + 5), event.pid);
+        }
+        return commPid(payload, event.comm, event.pid);
+    }
+
+    if (field(payload, "prev_pid=", value)) {
+        std::string_view state;
+        if (!leadingInt(value, event.prevPid) || !field(payload, "prev_state=", state)) return false;
+        event.prevRunnable = !state.empty() && state[0] == 'R';
+        size_t commAt = payload.find(" next_comm=");
+        size_t pidAt = payload.find(" next_pid=");
+        if (commAt == std::string_view::npos || pidAt == std::string_view::npos || pidAt < commAt) return false;
+        event.comm = payload.substr(commAt + 11, pidAt - commAt - 11);
+        return leadingInt(payload.substr(pidAt + 10), event.pid);
+    }
+
+    // Compact trace-cmd form: "a:1 [120] S ==> b:2 [120]"
+    size_t arrow = payload.find(" ==> ");
+    if (arrow == std::string_view::npos) return false;
+    std::string_view prevComm;
+    std::string_view left = payload.substr(0, arrow);
+    if (!commPid(left, prevComm, event.prevPid)) return false;
+    size_t close = left.rfind(']');
+    if (close == std::string_view::npos) return false;
+    std::string_view state = left.substr(close + 1);
+    while (!state.empty() && state.front() == ' ') state.remove_prefix(1);
+    event.prevRunnable = !state.empty() && state[0] == 'R';
+    return commPid(payload.substr(arrow + 5), event.comm, event.pid);
+}
+
+SchedTraceReader::Counts SchedTraceReader::read(const std::string& path,
+                                                const std::function<void(const Event&)>& sink) {
+    Counts counts;
+    FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) return counts;
+    counts.opened = true;
+
+    // Block buffer; a line cut by the block end moves to the front
+    std::vector<char> buffer(BLOCK_SIZE);
+    size_t carried = 0;
+    Event event{};
+    while (true) {
+        if (carried == buffer.size()) buffer.resize(buffer.size() * 2); // Line longer than a block
+        size_t got = std::fread(buffer.data() + carried, 1, buffer.size() - carried, file);
+        counts.bytes += (long long)got;
+        size_t filled = carried + got;
+        bool last = got == 0;
+        if (filled == 0) break;
+
+        size_t start = 0;
+        while (start < filled) {
+            const char* newline = (const char*)std::memchr(buffer.data() + start, '\n', filled - start);
+            if (!newline && !last) break;
+            size_t end = newline ? (size_t)(newline - buffer.data()) : filled;
+            std::string_view line(buffer.data() + start, end - start);
+            if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+            counts.lines++;
+
+            bool relevant = false;
+            if (parseLine(line, event, relevant)) {
+                counts.events++;
+                sink(event);
+            } else if (relevant) {
+                counts.skipped++;
+            }
+            start = end + 1;
+        }
+        if (last) break;
+
+        carried = filled - std::min(start, filled);
+        std::memmove(buffer.data(), buffer.data() + filled - carried, carried);
+    }
+    std::fclose(file);
+    return counts;
+}
@@ -0,0 +1,152 @@
+#include "../../include/utils/TracePyramid.h"
+#include <algorithm>
+#include <fstream>
+#include <cstring>
+
+TracePyramid::TracePyramid(const std::vector<Lane>& lanes, int horizon)
+    : lanes(lanes), horizon(std::max(1, horizon)) {
+    base.bucketTicks = 1;
+    base.busy.assign((size_t)this->horizon * lanes.size(), 0);
+    base.misses.assign(this->horizon, 0);
+    base.budgetMin.assign(this->horizon, -1);
+    base.budgetMax.assign(this->horizon, -1);
+}
+
+void TracePyramid::addBusyTick(int lane, int tick) {
+    if (lane < 0 || tick < 0 || tick >= horizon) return;
+    base.busy[(size_t)tick * lanes.size() + lane]++;
+}
+
+void TracePyramid::addMiss(int tick) {
+    // Misses are stamped at t + 1, which can be one past the last tick
+    tick = std::min(std::max(tick, 0), horizon - 1);
+    base.misses[tick]++;
+}
+
+void TracePyramid::setBudget(int tick, int budget) {
+    if (tick < 0 || tick >= horizon) return;
+    base.budgetMin[tick] = budget;
+    base.budgetMax[tick] = budget;
+}
+
+std::vector<TracePyramid::Level> TracePyramid::buildLevels() const {
+    std::vector<Level> levels;
+    levels.push_back(base);
+    size_t laneCount = lanes.size();
+
+    // Each level merges pairs of buckets from the one below
+    while (levels.back().misses.size() > 1) {
+        const Level& prev = levels.back();
+        size_t prevCount = prev.misses.size();
+        size_t count = (prevCount + 1) / 2;
+
+        Level next;
+        next.bucketTicks = prev.bucketTicks * 2;
+        next.busy.assign(count * laneCount, 0);
+        next.misses.assign(count, 0);
+        next.budgetMin.assign(count, -1);
+        next.budgetMax.assign(count, -1);
+
+        for (size_t b = 0; b < prevCount; b++) {
+            size_t to = b / 2;
+            for (size_t l = 0; l < laneCount; l++) next.busy[to * laneCount + l] += prev.busy[b * laneCount + l];
+            next.misses[to] += prev.misses[b];
+
+            if (prev.budgetMin[b] >= 0) {
+                next.budgetMin[to] = next.budgetMin[to] < 0 ? prev.budgetMin[b] : std::min(next.budgetMin[to], prev.budgetMin[b]);
+                next.budgetMax[to] = std::max(next.budgetMax[to], prev.budgetMax[b]);
+            }
+        }
+        levels.push_back(next);
+    }
+    return levels;
+}
+
+bool TracePyramid::write(const std::string& path) const {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) return false;
+
+    auto put32 = [&out](uint32_t v) { out.write(reinterpret_cast<const char*>(&v), 4); };
+    auto put64 = [&out](uint64_t v) { out.write(reinterpret_cast<const char*>(&v), 8); };
+
+    std::vector<Level> levels = buildLevels();
+    size_t laneCount = lanes.size();
+
+    out.write("RTLOD1\0\0", 8);
+    put32((uint32_t)levels.size());
+    put32((uint32_t)laneCount);
+    put32((uint32_t)horizon);
+    put32(10); // ticks per user time unit, as in FileReader
+
+    for (const auto& lane : lanes) {
+        put32((uint32_t)lane.taskId);
+        uint16_t len = (uint16_t)std::min<size_t>(lane.name.size(), 0xFFFF);
+        out.write(reinterpret_cast<const char*>(&len), 2);
+        out.write(lane.name.data(), len);
+    }
+
+    // Level table, then the level payloads back to back
+    uint64_t offset = (uint64_t)out.tellp() + levels.size() * 16;
+    size_t recordSize = laneCount * 4 + 12;
+    for (const auto& level : levels) {
+        put32((uint32_t)level.bucketTicks);
+        put32((uint32_t)level.misses.size());
+        put64(offset);
+        offset += level.misses.size() * recordSize;
+    }
+
+    for (const auto& level : levels) {
+        for (size_t b = 0; b < level.misses.size(); b++) {
+            // Last bucket may be partial: divide by the ticks it really covers
+            int start = (int)b * level.bucketTicks;
+            int width = std::min(level.bucketTicks, horizon - start);
+            for (size_t l = 0; l < laneCount; l++) {
+                float busy = width > 0 ? (float)level.busy[b * laneCount + l] / width : 0.0f;
+                out.write(reinterpret_cast<const char*>(&busy), 4);
+            }
+            put32(level.misses[b]);
+            put32((uint32_t)level.budgetMin[b]);
+            put32((uint32_t)level.budgetMax[b]);
+        }
+    }
+    return (bool)out;
+}
+
+bool TracePyramid::readBudget(const std::string& path, std::vector<int32_t>& budget) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in.is_open()) return false;
+
+    char magic[8];
+    uint32_t header[4]; // levels, lanes, horizon, ticks per unit
+    in.read(magic, 8);
+    in.read(reinterpret_cast<char*>(header), sizeof(header));
+    if (!in || std::string(magic, 8) != std::string("RTLOD1\0\0", 8) || header[0] == 0) return false;
+
+    for (uint32_t l = 0; l < header[1]; l++) {
+        int32_t taskId;
+        uint16_t len;
+        in.read(reinterpret_cast<char*>(&taskId), 4);
+        in.read(reinterpret_cast<char*>(&len), 2);
+        in.seekg(len, std::ios::cur);
+    }
+
+    // Level 0 is one tick per bucket
+    uint32_t bucketTicks, count;
+    uint64_t offset;
+    in.read(reinterpret_cast<char*>(&bucketTicks), 4);
+    in.read(reinterpret_cast<char*>(&count), 4);
+    in.read(reinterpret_cast<char*>(&offset), 8);
+    if (!in || bucketTicks != 1) return false;
+
+    size_t recordSize = header[1] * 4 + 12;
+    std::vector<char> record(recordSize);
+    budget.assign(count, -1);
+    bool any = false;
+
+    in.seekg((std::streamoff)offset);
+    for (uint32_t b = 0; b < count && in.read(record.data(), recordSize); b++) {
+        std::memcpy(&budget[b], record.data() + header[1] * 4 + 4, 4);
+        any = any || budget[b] >= 0;
+    }
+    return any;
+}
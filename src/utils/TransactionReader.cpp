@@ -0,0 +1,138 @@
+#include "../../include/utils/TransactionReader.h"
+#include <fstream>
+#include <sstream>
+#include <cmath>
+#include <algorithm>
+#include <cstdlib>
+
+namespace {
+
+const int SCALE_FACTOR = 10; // Same scaling as FileReader
+
+int toTicks(double units) { return (int)std::round(units * SCALE_FACTOR); }
+
+// "<node>:<exec>"
+bool parseStep(const std::string& text, TransactionStep& step) {
+    size_t colon = text.find(':');
+    if (colon == std::string::npos || colon == 0) return false;
+    char* end = nullptr;
+    step.node = (int)std::strtol(text.c_str(), &end, 10);
+    if (end != text.c_str() + colon) return false;
+    double exec = std::atof(text.c_str() + colon + 1);
+    step.computationTime = toTicks(exec);
+    return step.computationTime > 0;
+}
+
+} // namespace
+
+bool TransactionReader::parseAlgorithm(const std::string& text, AlgorithmKind& kind) {
+    if (text == "RM" || text == "1") kind = AlgorithmKind::RateMonotonic;
+    else if (text == "DM" || text == "2") kind = AlgorithmKind::DeadlineMonotonic;
+    else if (text == "EDF" || text == "3") kind = AlgorithmKind::EDF;
+    else if (text == "LST" || text == "4") kind = AlgorithmKind::LeastSlackTime;
+    else return false;
+    return true;
+}
+
+TransactionReader::Result TransactionReader::read(const std::string& path) {
+    Result result;
+    std::ifstream file(path);
+    if (!file.is_open()) return result;
+    result.opened = true;
+
+    DistributedSystem& system = result.system;
+    std::string line;
+    int taskId = 1;
+    while (std::getline(file, line)) {
+        line = line.substr(0, line.find('#'));
+        std::stringstream ss(line);
+        std::string kind;
+        if (!(ss >> kind)) continue; // Blank or comment
+
+        if (kind == "N") {
+            NodeSpec node;
+            std::string algorithm;
+            if (!(ss >> node.id >> algorithm) || !parseAlgorithm(algorithm, node.algorithm)) {
+                result.skippedLines++;
+                continue;
+            }
+            system.nodes.push_back(node);
+        } else if (kind == "L") {
+            MessageLink link;
+            double latency = 0, maxLatency = -1;
+            if (!(ss >> link.from >> link.to >> latency) || latency < 0) { result.skippedLines++; continue; }
+            if (!(ss >> maxLatency)) maxLatency = latency;
+            link.minLatency = toTicks(latency);
+            link.maxLatency = std::max(link.minLatency, toTicks(maxLatency));
+            system.links.push_back(link);
+        } else if (kind == "T") {
+            Transaction tr;
+            double period = 0, deadline = 0;
+            if (!(ss >> period >> deadline) || period <= 0 || deadline <= 0) { result.skippedLines++; continue; }
+            tr.id = (int)system.transactions.size() + 1;
+            tr.period = toTicks(period);
+            tr.deadline = toTicks(deadline);
+            std::string text;
+            bool valid = true;
+            while (ss >> text) {
+                TransactionStep step;
+                if (!parseStep(text, step)) { valid = false; break; }
+                tr.steps.push_back(step);
+            }
+            if (!valid || tr.steps.empty()) { result.skippedLines++; continue; }
+            for (auto& step : tr.steps) step.taskId = taskId++;
+            system.transactions.push_back(tr);
+        } else {
+            result.skippedLines++;
+        }
+    }
+
+    // --- CONSISTENCY ---
+    auto hasNode = [&](int id) {
+        return std::any_of(system.nodes.begin(), system.nodes.end(), [id](const NodeSpec& n) { return n.id == id; });
+    };
+    for (size_t i = 0; i < system.nodes.size(); i++) {
+        for (size_t j = 0; j < i; j++) {
+            if (system.nodes[i].id == system.nodes[j].id) {
+                result.errors.push_back("node " + std::to_string(system.nodes[i].id) + " declared twice");
+            }
+        }
+    }
+    for (const auto& link : system.links) {
+        std::string name = "link " + std::to_string(link.from) + "->" + std::to_string(link.to);
+        if (!hasNode(link.from) || !hasNode(link.to)) result.errors.push_back(name + ": unknown node");
+        // Cross-node messages are what lets nodes run ahead of each other
+        // (DistributedSimulator), so they take at least one tick
+        if (link.from != link.to && link.minLatency < 1) result.errors.push_back(name + ": latency below 0.1");
+    }
+    for (const auto& tr : system.transactions) {
+        std::string name = "transaction " + std::to_string(tr.id);
+        for (size_t k = 0; k < tr.steps.size(); k++) {
+            if (!hasNode(tr.steps[k].node)) {
+                result.errors.push_back(name + ": unknown node " + std::to_string(tr.steps[k].node));
+            } else if (k > 0 && system.maxLatency(tr.steps[k - 1].node, tr.steps[k].node) < 0) {
+                result.errors.push_back(name + ": no link " + std::to_string(tr.steps[k - 1].node) + "->" +
+                                        std::to_string(tr.steps[k].node));
+            }
+        }
+    }
+    splitDeadlines(system);
+    return result;
+}
+
+void TransactionReader::splitDeadlines(DistributedSystem& system) {
+    for (auto& tr : system.transactions) {
+        long long exec = 0, latency = 0;
+        for (size_t k = 0; k < tr.steps.size(); k++) {
+            exec += tr.steps[k].computationTime;
+            if (k > 0) latency += std::max(0, system.maxLatency(tr.steps[k - 1].node, tr.steps[k].node));
+        }
+
+        // What is left of the deadline after the messages, shared out by
+        // execution time
+        long long budget = std::max(0LL, tr.deadline - latency);
+        for (auto& step : tr.steps) {
+            step.localDeadline = std::max(step.computationTime, (int)(budget * step.computationTime / exec));
+        }
+    }
+}